@@ -0,0 +1,460 @@
+#ifndef CONTIGUOUS_PLAYLIST_H
+#define CONTIGUOUS_PLAYLIST_H
+#include "OutOfRangeExcept.h"
+#include "PlaylistStats.h"
+#include "Song.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/*
+    Author: Ky Lam
+    Date: October 18, 2026
+    Description: ContiguousPlaylist is a playlist container with the same interface as DoublyLinkedList<Song>,
+    so MusicBox can use either one. Instead of one heap node per song, it keeps the songs in parallel arrays:
+    every title is stored back to back in one character buffer and located by an offset and a length,
+    the durations sit in an array of their own, and the links are 32-bit slot indices instead of pointers.
+    Walking the list, reading titles through getTitle() and swapping songs then touch a few dense arrays
+    and never allocate; only get(), at() and replace() build a Song, which copies its title.
+    Slot 0 is never used, so a Position of 0 plays the role of nullptr.
+    Removed slots are reused by later push_backs, and the title buffer is compacted once
+    more than half of it belongs to removed or replaced titles.
+*/
+
+class ContiguousPlaylist
+{
+public:
+    typedef std::uint32_t Position;     // The slot of a song, 0 for none.
+
+private:
+    std::vector<char> titleBytes;               // Every title, back to back.
+    std::vector<std::uint32_t> titleOffsets;    // titleOffsets[slot] is where the title of the slot starts in titleBytes.
+    std::vector<std::uint32_t> titleLengths;    // titleLengths[slot] is the length of the title of the slot.
+    std::vector<int> durations;                 // durations[slot] is the duration of the song of the slot in seconds.
+    std::vector<Position> nexts;                // nexts[slot] is the slot of the following song, or the next free slot.
+    std::vector<Position> previouses;           // previouses[slot] is the slot of the preceding song.
+    Position head;                              // The slot of the first song.
+    Position tail;                              // The slot of the last song.
+    Position freeSlots;                         // The first of the removed slots waiting to be reused.
+    std::size_t unusedTitleBytes;               // Bytes of titleBytes that no song refers to anymore.
+    int count;                                  // Number of songs in the list.
+
+    // Store the title and duration of a song in a slot.
+    void store(Position slot, const Song& song);
+
+    // Check if the song in a slot is equal to the given one, without building a Song.
+    bool matches(Position slot, const Song& song) const;
+
+    // Get the slot of the song at a 1-based position.
+    Position slotAt(int position) const;
+
+    // Rewrite titleBytes with only the titles still in use.
+    void compactTitles();
+
+public:
+    // Constructor: Initializes an empty list.
+    ContiguousPlaylist();
+
+    // Add a song to the end of the list.
+    void push_back(const Song& newItem);
+
+    // Remove a song from the list.
+    bool remove(const Song& removeItem);
+
+    // Remove every song equal to the given one in a single pass.
+    int erase_all(const Song& removeItem);
+
+    // Remove every song for which the predicate returns true in a single pass.
+    template <class Predicate>
+    int remove_if(Predicate shouldRemove);
+
+    // Remove the song in a slot without searching for it.
+    Position erase(Position removeSlot);
+
+    // Remove all songs from the list.
+    void clear();
+
+    // Get the current size of the list.
+    int getSize() const;
+
+    // Get a song at a given position.
+    Song at(int position) const;
+
+    // Check if the song is on the list.
+    bool contains(const Song& checkItem) const;
+
+    // Replace a song at a given position with a new song.
+    Song replace(int position, const Song& newItem);
+
+    // Positions of the first and last songs, and of the songs around a given one.
+    Position getHead() const
+    {
+        return head;
+    }
+    Position getTail() const
+    {
+        return tail;
+    }
+    Position next(Position slot) const
+    {
+        return nexts[slot];
+    }
+    Position previous(Position slot) const
+    {
+        return previouses[slot];
+    }
+
+    // Get the song in a slot.
+    Song get(Position slot) const;
+
+    // Get the title or the duration of the song in a slot without building a Song.
+    // The title points into the list and is only valid until the next push_back, erase or replace.
+    std::string_view getTitle(Position slot) const;
+    int getDuration(Position slot) const;
+
+    // Exchange the songs in two slots, leaving the links alone.
+    void swapItems(Position first, Position second);
+
+    // Link the slots into a new order, leaving the songs in their slots.
+    void relink(const std::vector<Position>& order);
+};
+
+// Constructor
+// Slot 0 is created up front and linked to itself, so next(0) and previous(0) stay 0.
+ContiguousPlaylist::ContiguousPlaylist(): titleOffsets(1, 0), titleLengths(1, 0), durations(1, 0), nexts(1, 0), previouses(1, 0),
+    head(0), tail(0), freeSlots(0), unusedTitleBytes(0), count(0)
+{
+}
+
+// Store the title and duration of a song in a slot, appending the title to titleBytes.
+void ContiguousPlaylist::store(Position slot, const Song& song)
+{
+    const std::string& title = song.getTitle();
+    titleOffsets[slot] = static_cast<std::uint32_t>(titleBytes.size());
+    titleLengths[slot] = static_cast<std::uint32_t>(title.size());
+    durations[slot] = song.getDuration();
+    titleBytes.insert(titleBytes.end(), title.begin(), title.end());
+}
+
+// Check if the song in a slot has the same title and duration as the given one.
+bool ContiguousPlaylist::matches(Position slot, const Song& song) const
+{
+    if (durations[slot] != song.getDuration())
+    {
+        return false;
+    }
+
+    const std::string& title = song.getTitle();
+    return titleLengths[slot] == title.size()
+        && std::equal(title.begin(), title.end(), titleBytes.begin() + titleOffsets[slot]);
+}
+
+// Get the slot of the song at a 1-based position.
+// Throws: OutOfRangeExcept if the position is out of bounds.
+ContiguousPlaylist::Position ContiguousPlaylist::slotAt(int position) const
+{
+    if (position <= 0 || position > count)
+    {
+        throw OutOfRangeExcept();
+    }
+
+    Position slot = head;
+    for (int i = 1; i < position; i++)
+    {
+        slot = nexts[slot];
+    }
+    MELODY_STATS_COUNT(LIST_NODES_TRAVERSED, position);
+    return slot;
+}
+
+// Rewrite titleBytes in list order with only the titles still in use.
+void ContiguousPlaylist::compactTitles()
+{
+    std::vector<char> compacted;
+    compacted.reserve(titleBytes.size() - unusedTitleBytes);
+
+    for (Position slot = head; slot != 0; slot = nexts[slot])
+    {
+        std::uint32_t offset = static_cast<std::uint32_t>(compacted.size());
+        compacted.insert(compacted.end(), titleBytes.begin() + titleOffsets[slot],
+                         titleBytes.begin() + titleOffsets[slot] + titleLengths[slot]);
+        titleOffsets[slot] = offset;
+    }
+
+    titleBytes.swap(compacted);
+    unusedTitleBytes = 0;
+}
+
+// Add a song to the end of the list, reusing a removed slot if there is one.
+// Parameters:
+//   - newItem: The song to be added.
+void ContiguousPlaylist::push_back(const Song& newItem)
+{
+    Position slot = freeSlots;
+    if (slot != 0)
+    {
+        freeSlots = nexts[slot];
+    }
+    else
+    {
+        slot = static_cast<Position>(nexts.size());
+        titleOffsets.push_back(0);
+        titleLengths.push_back(0);
+        durations.push_back(0);
+        nexts.push_back(0);
+        previouses.push_back(0);
+        MELODY_STATS_COUNT(LIST_NODE_ALLOCATIONS, 1);
+    }
+    MELODY_STATS_COUNT(LIST_PUSH_BACKS, 1);
+
+    store(slot, newItem);
+    nexts[slot] = 0;
+    previouses[slot] = tail;
+
+    if (head == 0)
+    {
+        head = slot;
+    }
+    else
+    {
+        nexts[tail] = slot;
+    }
+    tail = slot;
+    count++;
+}
+
+// Remove a given song from the list.
+// Parameters:
+//   - removeItem: The song to remove.
+// Returns: True if the removal is successful, false otherwise.
+bool ContiguousPlaylist::remove(const Song& removeItem)
+{
+    for (Position slot = head; slot != 0; slot = nexts[slot])
+    {
+        MELODY_STATS_COUNT(LIST_NODES_TRAVERSED, 1);
+        if (matches(slot, removeItem))
+        {
+            erase(slot);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Remove every song equal to the given one.
+// Parameters:
+//   - removeItem: The song to remove.
+// Returns: The number of songs removed.
+int ContiguousPlaylist::erase_all(const Song& removeItem)
+{
+    int removed = 0;
+    Position slot = head;
+    while (slot != 0)
+    {
+        MELODY_STATS_COUNT(LIST_NODES_TRAVERSED, 1);
+        if (matches(slot, removeItem))
+        {
+            slot = erase(slot);
+            removed++;
+        }
+        else
+        {
+            slot = nexts[slot];
+        }
+    }
+    return removed;
+}
+
+// Remove every song for which the predicate returns true, walking the list once.
+// Parameters:
+//   - shouldRemove: Called as shouldRemove(const Song&) once for every song.
+// Returns: The number of songs removed.
+template <class Predicate>
+int ContiguousPlaylist::remove_if(Predicate shouldRemove)
+{
+    int removed = 0;
+    Position slot = head;
+    while (slot != 0)
+    {
+        MELODY_STATS_COUNT(LIST_NODES_TRAVERSED, 1);
+        if (shouldRemove(get(slot)))
+        {
+            slot = erase(slot);
+            removed++;
+        }
+        else
+        {
+            slot = nexts[slot];
+        }
+    }
+    return removed;
+}
+
+// Remove the song in a slot and put the slot on the free list.
+// Parameters:
+//   - removeSlot: A slot that holds a song of this list.
+// Returns: The slot of the following song, or 0 if it was the last one.
+ContiguousPlaylist::Position ContiguousPlaylist::erase(Position removeSlot)
+{
+    Position nextSlot = nexts[removeSlot];
+    Position previousSlot = previouses[removeSlot];
+
+    if (previousSlot == 0)
+    {
+        head = nextSlot;
+    }
+    else
+    {
+        nexts[previousSlot] = nextSlot;
+    }
+
+    if (nextSlot == 0)
+    {
+        tail = previousSlot;
+    }
+    else
+    {
+        previouses[nextSlot] = previousSlot;
+    }
+
+    unusedTitleBytes += titleLengths[removeSlot];
+    nexts[removeSlot] = freeSlots;
+    previouses[removeSlot] = 0;
+    freeSlots = removeSlot;
+    count--;
+    MELODY_STATS_COUNT(LIST_NODE_DELETIONS, 1);
+
+    if (unusedTitleBytes > titleBytes.size() / 2)
+    {
+        compactTitles();
+    }
+    return nextSlot;
+}
+
+// Remove all songs from the list and release the slots.
+void ContiguousPlaylist::clear()
+{
+    MELODY_STATS_COUNT(LIST_NODE_DELETIONS, count);
+
+    titleBytes.clear();
+    titleOffsets.assign(1, 0);
+    titleLengths.assign(1, 0);
+    durations.assign(1, 0);
+    nexts.assign(1, 0);
+    previouses.assign(1, 0);
+    head = tail = freeSlots = 0;
+    unusedTitleBytes = 0;
+    count = 0;
+}
+
+// Get the number of songs in the list.
+int ContiguousPlaylist::getSize() const
+{
+    return count;
+}
+
+// Get a song at a given position.
+// Parameters:
+//   - position: The position of the song to retrieve (1-based).
+// Returns: The song at the specified position.
+// Throws: OutOfRangeExcept if the position is out of bounds.
+Song ContiguousPlaylist::at(int position) const
+{
+    return get(slotAt(position));
+}
+
+// Check if the song is on the list.
+// Parameters:
+//   - checkItem: The song needs to be checked.
+// Returns: True if the song is on the list, false otherwise.
+bool ContiguousPlaylist::contains(const Song& checkItem) const
+{
+    for (Position slot = head; slot != 0; slot = nexts[slot])
+    {
+        MELODY_STATS_COUNT(LIST_NODES_TRAVERSED, 1);
+        if (matches(slot, checkItem))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Replace a song at a given position with a new song.
+// Parameters:
+//   - position: The position of the song to replace (1-based).
+//   - newItem: The new song to replace the old one.
+// Returns: The old song that was replaced.
+// Throws: OutOfRangeExcept if the position is out of bounds.
+Song ContiguousPlaylist::replace(int position, const Song& newItem)
+{
+    Position slot = slotAt(position);
+    Song oldEntry = get(slot);
+
+    unusedTitleBytes += titleLengths[slot];
+    store(slot, newItem);
+    if (unusedTitleBytes > titleBytes.size() / 2)
+    {
+        compactTitles();
+    }
+    return oldEntry;
+}
+
+// Get the song in a slot.
+Song ContiguousPlaylist::get(Position slot) const
+{
+    return Song(std::string(getTitle(slot)), durations[slot]);
+}
+
+// Get the title of the song in a slot.
+std::string_view ContiguousPlaylist::getTitle(Position slot) const
+{
+    return std::string_view(titleBytes.data() + titleOffsets[slot], titleLengths[slot]);
+}
+
+// Get the duration in seconds of the song in a slot.
+int ContiguousPlaylist::getDuration(Position slot) const
+{
+    return durations[slot];
+}
+
+// Exchange the songs in two slots. Only the title locations and durations move, not the title bytes.
+void ContiguousPlaylist::swapItems(Position first, Position second)
+{
+    std::swap(titleOffsets[first], titleOffsets[second]);
+    std::swap(titleLengths[first], titleLengths[second]);
+    std::swap(durations[first], durations[second]);
+}
+
+// Link the slots into a new order. Only the links change, so no title or duration moves.
+// Parameters:
+//   - order: Every slot of the list exactly once, in the order they should have.
+void ContiguousPlaylist::relink(const std::vector<Position>& order)
+{
+    Position previousSlot = 0;
+    for (std::size_t i = 0; i < order.size(); i++)
+    {
+        previouses[order[i]] = previousSlot;
+        if (previousSlot == 0)
+        {
+            head = order[i];
+        }
+        else
+        {
+            nexts[previousSlot] = order[i];
+        }
+        previousSlot = order[i];
+    }
+
+    if (previousSlot != 0)
+    {
+        nexts[previousSlot] = 0;
+    }
+    tail = previousSlot;
+}
+
+#endif
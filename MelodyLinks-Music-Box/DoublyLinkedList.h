@@ -1,8 +1,14 @@
 #ifndef DOUBLY_LINKED_LIST
 #define DOUBLY_LINKED_LIST
+#include "ListPolicies.h"
 #include "OutOfRangeExcept.h"
+#include "PlaylistStats.h"
 #include "Song.h"
 
+#include <string_view>
+#include <utility>
+#include <vector>
+
 /*
     Author: Ky Lam
     Date: October 29, 2023
@@ -11,6 +17,8 @@
     This list allows you to add items to the end, remove specific elements, 
     check the current size, retrieve items at a given index, 
     verify item existence, and replace elements.
+    Two optional policies from ListPolicies.h trim the list for hot loops: whether it tracks its size,
+    and whether at() and replace() check their position. The defaults keep the original behavior.
 */
 
 template <class T>
@@ -25,23 +33,27 @@ struct Node
 };
 
 
-template <class T>
-class DoublyLinkedList
+template <class T, class SizePolicy = TrackedSize, class AccessPolicy = CheckedAccess>
+class DoublyLinkedList : private SizePolicy
 {
     private:
         Node<T>* head;      // Pointer to the head (start) of the list.
         Node<T>* tail;      // Pointer to the tail (last) of the list.
-        int count;          // Number of items in the list.
+
+        // Get the node at a given position, checking it as the access policy asks.
+        Node<T>* nodeAt(int position) const;
 
     public:
+        typedef Node<T>* Position;  // A node of the list, nullptr for none.
+
         // Constructor: Initializes an empty list.
         DoublyLinkedList();
 
         // Copy constructor: Creates a new DoublyLinkedList as a copy of another DoublyLinkedList.
-        DoublyLinkedList(const DoublyLinkedList<T>& other);
+        DoublyLinkedList(const DoublyLinkedList<T, SizePolicy, AccessPolicy>& other);
 
         // Assignment operator: Assigns the contents of another DoublyLinkedList to this one.
-        DoublyLinkedList<T>& operator=(const DoublyLinkedList<T>& other);
+        DoublyLinkedList<T, SizePolicy, AccessPolicy>& operator=(const DoublyLinkedList<T, SizePolicy, AccessPolicy>& other);
 
         // Add an item to the end of the list.
         void push_back(const T& newItem);
@@ -49,6 +61,19 @@ class DoublyLinkedList
         // Remove an item from list.
         bool remove(const T& removeItem);
 
+        // Remove every item equal to the given one in a single pass.
+        int erase_all(const T& removeItem);
+
+        // Remove every item for which the predicate returns true in a single pass.
+        template <class Predicate>
+        int remove_if(Predicate shouldRemove);
+
+        // Unlink and delete a node of this list without searching for it.
+        Node<T>* erase(Node<T>* removeNode);
+
+        // Remove all items from the list.
+        void clear();
+
         // Get the current size of the list.
         int getSize() const;
 
@@ -74,19 +99,50 @@ class DoublyLinkedList
             return tail;
         }
 
+        // Position helpers: these let MusicBox walk and edit any playlist container the same way.
+        Node<T>* next(Node<T>* node) const
+        {
+            return node->next;
+        }
+        Node<T>* previous(Node<T>* node) const
+        {
+            return node->previous;
+        }
+        const T& get(Node<T>* node) const
+        {
+            return node->data;
+        }
+        void swapItems(Node<T>* first, Node<T>* second)
+        {
+            std::swap(first->data, second->data);
+        }
+
+        // Link the nodes into a new order without moving any item.
+        void relink(const std::vector<Node<T>*>& order);
+
+        // Title and duration helpers for lists of Songs, so MusicBox reads them the same way from every container.
+        std::string_view getTitle(Node<T>* node) const
+        {
+            return node->data.getTitle();
+        }
+        int getDuration(Node<T>* node) const
+        {
+            return node->data.getDuration();
+        }
+
 };
 
 // Constructor
-template <class T>
-DoublyLinkedList<T>::DoublyLinkedList(): head(nullptr), tail(nullptr), count(0)
+template <class T, class SizePolicy, class AccessPolicy>
+DoublyLinkedList<T, SizePolicy, AccessPolicy>::DoublyLinkedList(): head(nullptr), tail(nullptr)
 {
 }
 
 // Copy Constructor
 // Parameters:
 //     - other: the other DoublyLinkedList is copied.
-template <class T>
-DoublyLinkedList<T>::DoublyLinkedList(const DoublyLinkedList<T>& other): head(nullptr), tail(nullptr), count(0)
+template <class T, class SizePolicy, class AccessPolicy>
+DoublyLinkedList<T, SizePolicy, AccessPolicy>::DoublyLinkedList(const DoublyLinkedList<T, SizePolicy, AccessPolicy>& other): head(nullptr), tail(nullptr)
 {
     Node<T>* curr = other.head;
     while (curr != nullptr)
@@ -100,25 +156,16 @@ DoublyLinkedList<T>::DoublyLinkedList(const DoublyLinkedList<T>& other): head(nu
 // Parameters:
 //     - other: the other DoublyLinkedList is copied.
 // Returns: the new DoublyLinkedList after copy from the other.
-template <class T>
-DoublyLinkedList<T>& DoublyLinkedList<T>::operator=(const DoublyLinkedList<T>& other)
+template <class T, class SizePolicy, class AccessPolicy>
+DoublyLinkedList<T, SizePolicy, AccessPolicy>& DoublyLinkedList<T, SizePolicy, AccessPolicy>::operator=(const DoublyLinkedList<T, SizePolicy, AccessPolicy>& other)
 {
     if (this == &other)
     {
         return *this;
     }
     
-   //Clean the current list
-    Node<T>* curr = head;
-    while (curr != nullptr)  
-    {
-        Node<T>* temp = curr->next;
-        delete curr;
-        curr = temp;
-    }
-    head = nullptr;
-    tail = nullptr;
-    count = 0;
+    //Clean the current list
+    clear();
 
     // Copy items from other list to this list
     Node<T>* otherCurr = other.head;
@@ -135,10 +182,12 @@ DoublyLinkedList<T>& DoublyLinkedList<T>::operator=(const DoublyLinkedList<T>& o
 // Add an item to the end of the list.
 // Parameters:
 //   - newItem: The item to be added.
-template <class T>
-void DoublyLinkedList<T>::push_back (const T& newItem)
+template <class T, class SizePolicy, class AccessPolicy>
+void DoublyLinkedList<T, SizePolicy, AccessPolicy>::push_back (const T& newItem)
 {
     Node<T>* newNode = new Node<T>(newItem, nullptr, nullptr);
+    MELODY_STATS_COUNT(LIST_PUSH_BACKS, 1);
+    MELODY_STATS_COUNT(LIST_NODE_ALLOCATIONS, 1);
 
     if(head == nullptr) //If the list is empty
     {
@@ -151,45 +200,23 @@ void DoublyLinkedList<T>::push_back (const T& newItem)
         newNode->previous = tail;
         tail = newNode;
     }
-    count++;
+    this->countAdded();
 }
 
 // Remove an given item from the list.
 // Parameters:
 //   - removeItem: The item to remove.
 // Returns: True if the removal is successful, false otherwise.
-template <class T>
-bool DoublyLinkedList<T>::remove(const T& removeItem)
+template <class T, class SizePolicy, class AccessPolicy>
+bool DoublyLinkedList<T, SizePolicy, AccessPolicy>::remove(const T& removeItem)
 {
     Node<T>* curr = head;
     while (curr != nullptr)
     {
+        MELODY_STATS_COUNT(LIST_NODES_TRAVERSED, 1);
         if(curr->data == removeItem)
         {
-            if(curr == head && curr == tail)
-            {
-                head = tail = nullptr;
-            }
-            else if(curr == head)
-            {
-                head = curr->next;
-                head->previous = nullptr;
-
-            }
-            else if(curr == tail)
-            {
-                tail = curr->previous;
-                tail->next = nullptr;
-            }
-            else
-            {
-                curr->previous->next = curr->next;
-                curr->next->previous = curr->previous;
-            }
-
-            delete curr;
-            curr = nullptr;
-            count--;
+            erase(curr);
             return true;
         }
 
@@ -198,47 +225,178 @@ bool DoublyLinkedList<T>::remove(const T& removeItem)
     return false;
 }
 
-// Get the number of items in the list.
-template <class T>
-int DoublyLinkedList<T>::getSize() const
+// Remove every item equal to the given one.
+// Parameters:
+//   - removeItem: The item to remove.
+// Returns: The number of items removed.
+template <class T, class SizePolicy, class AccessPolicy>
+int DoublyLinkedList<T, SizePolicy, AccessPolicy>::erase_all(const T& removeItem)
 {
-    return count;
+    return remove_if([&removeItem](const T& item) { return item == removeItem; });
 }
 
-// Get an item at a given position.
+// Remove every item for which the predicate returns true.
+// The list is walked once and every matching node is unlinked where it is found, so removing k items costs O(n + k).
 // Parameters:
-//   - position: The position of the item to retrieve (1-based).
-// Returns: The item at the specified position.
-// Throws: OutOfRangeExcept if the position is out of bounds.
-template <class T>
-T DoublyLinkedList<T>::at (int position) const
+//   - shouldRemove: Called as shouldRemove(const T&) once for every item.
+// Returns: The number of items removed.
+template <class T, class SizePolicy, class AccessPolicy>
+template <class Predicate>
+int DoublyLinkedList<T, SizePolicy, AccessPolicy>::remove_if(Predicate shouldRemove)
 {
-    if(position > 0 && position <= count)
+    int removed = 0;
+    Node<T>* curr = head;
+    while (curr != nullptr)
     {
-        Node<T>* curr = head;
-        for (int i = 1; i < position; i++)
+        MELODY_STATS_COUNT(LIST_NODES_TRAVERSED, 1);
+        if (shouldRemove(curr->data))
+        {
+            curr = erase(curr);
+            removed++;
+        }
+        else
         {
             curr = curr->next;
         }
+    }
+    return removed;
+}
+
+// Unlink and delete a node of this list.
+// Parameters:
+//   - removeNode: A node that belongs to this list.
+// Returns: The node that followed the removed one, or nullptr if it was the tail.
+template <class T, class SizePolicy, class AccessPolicy>
+Node<T>* DoublyLinkedList<T, SizePolicy, AccessPolicy>::erase(Node<T>* removeNode)
+{
+    Node<T>* nextNode = removeNode->next;
+
+    if(removeNode == head && removeNode == tail)
+    {
+        head = tail = nullptr;
+    }
+    else if(removeNode == head)
+    {
+        head = removeNode->next;
+        head->previous = nullptr;
+    }
+    else if(removeNode == tail)
+    {
+        tail = removeNode->previous;
+        tail->next = nullptr;
+    }
+    else
+    {
+        removeNode->previous->next = removeNode->next;
+        removeNode->next->previous = removeNode->previous;
+    }
 
-        return curr->data;
+    delete removeNode;
+    MELODY_STATS_COUNT(LIST_NODE_DELETIONS, 1);
+    this->countRemoved();
+    return nextNode;
+}
+
+// Remove all items from the list.
+template <class T, class SizePolicy, class AccessPolicy>
+void DoublyLinkedList<T, SizePolicy, AccessPolicy>::clear()
+{
+    Node<T>* curr = head;
+    while (curr != nullptr)
+    {
+        Node<T>* temp = curr->next;
+        delete curr;
+        MELODY_STATS_COUNT(LIST_NODE_DELETIONS, 1);
+        curr = temp;
+    }
+
+    head = tail = nullptr;
+    this->resetCount();
+}
+
+// Get the number of items in the list.
+// With UntrackedSize this walks the list.
+template <class T, class SizePolicy, class AccessPolicy>
+int DoublyLinkedList<T, SizePolicy, AccessPolicy>::getSize() const
+{
+    if constexpr (SizePolicy::tracksSize)
+    {
+        return this->countedSize();
     }
     else
     {
-        throw OutOfRangeExcept();
+        int size = 0;
+        for (Node<T>* curr = head; curr != nullptr; curr = curr->next)
+        {
+            size++;
+        }
+        MELODY_STATS_COUNT(LIST_NODES_TRAVERSED, size);
+        return size;
     }
 }
 
+// Get the node at a given position.
+// Parameters:
+//   - position: The position of the node to retrieve (1-based).
+// Returns: The node at the specified position.
+// Throws: OutOfRangeExcept if the position is out of bounds and the list uses CheckedAccess.
+// Without a tracked size, the check happens while walking instead of before.
+template <class T, class SizePolicy, class AccessPolicy>
+Node<T>* DoublyLinkedList<T, SizePolicy, AccessPolicy>::nodeAt(int position) const
+{
+    if constexpr (AccessPolicy::checksAccess && SizePolicy::tracksSize)
+    {
+        if (position <= 0 || position > this->countedSize())
+        {
+            throw OutOfRangeExcept();
+        }
+    }
+    else if constexpr (AccessPolicy::checksAccess)
+    {
+        if (position <= 0 || head == nullptr)
+        {
+            throw OutOfRangeExcept();
+        }
+    }
+
+    Node<T>* curr = head;
+    for (int i = 1; i < position; i++)
+    {
+        curr = curr->next;
+        if constexpr (AccessPolicy::checksAccess && !SizePolicy::tracksSize)
+        {
+            if (curr == nullptr)
+            {
+                throw OutOfRangeExcept();
+            }
+        }
+    }
+    MELODY_STATS_COUNT(LIST_NODES_TRAVERSED, position);
+    return curr;
+}
+
+// Get an item at a given position.
+// Parameters:
+//   - position: The position of the item to retrieve (1-based).
+// Returns: The item at the specified position.
+// Throws: OutOfRangeExcept if the position is out of bounds and the list uses CheckedAccess.
+template <class T, class SizePolicy, class AccessPolicy>
+T DoublyLinkedList<T, SizePolicy, AccessPolicy>::at (int position) const
+{
+    return nodeAt(position)->data;
+}
+
 // Check if the item is on the list.
 // Parameters:
 //   - checkItem: The item needs to be checked.
 // Returns: True if the item is on the list, false otherwise.
-template <class T>
-bool DoublyLinkedList<T>::contains (const T& checkItem) const
+template <class T, class SizePolicy, class AccessPolicy>
+bool DoublyLinkedList<T, SizePolicy, AccessPolicy>::contains (const T& checkItem) const
 {
     Node<T>* curr = head;
     while (curr != nullptr)
     {
+        MELODY_STATS_COUNT(LIST_NODES_TRAVERSED, 1);
         if(curr->data == checkItem)
         {
             return true;
@@ -253,41 +411,49 @@ bool DoublyLinkedList<T>::contains (const T& checkItem) const
 //   - position: The position of the item to replace (1-based).
 //   - newItem: The new item to replace the old one.
 // Returns: The old element that was replaced.
-// Throws: OutOfRangeExcept if the position is out of bounds.
-template <class T>
-T DoublyLinkedList<T>::replace(int position, const T& newItem)
+// Throws: OutOfRangeExcept if the position is out of bounds and the list uses CheckedAccess.
+template <class T, class SizePolicy, class AccessPolicy>
+T DoublyLinkedList<T, SizePolicy, AccessPolicy>::replace(int position, const T& newItem)
+{
+    Node<T>* curr = nodeAt(position);
+    T oldEntry = curr->data;
+    curr->data = newItem;
+    return oldEntry;
+}
+
+// Link the nodes of the list into a new order. The items stay in their nodes, so nothing is copied.
+// Parameters:
+//   - order: Every node of this list exactly once, in the order they should have.
+template <class T, class SizePolicy, class AccessPolicy>
+void DoublyLinkedList<T, SizePolicy, AccessPolicy>::relink(const std::vector<Node<T>*>& order)
 {
-    if (position > 0 && position <= count)
+    Node<T>* previousNode = nullptr;
+    for (std::size_t i = 0; i < order.size(); i++)
     {
-        Node<T>* curr = head;
-        for (int i = 1; i < position; i++)
+        order[i]->previous = previousNode;
+        if (previousNode == nullptr)
         {
-            curr = curr->next;
+            head = order[i];
         }
-        T oldEntry = curr->data;
-        curr->data = newItem;
-        return oldEntry;
+        else
+        {
+            previousNode->next = order[i];
+        }
+        previousNode = order[i];
     }
-    else
+
+    if (previousNode != nullptr)
     {
-        throw OutOfRangeExcept();
+        previousNode->next = nullptr;
     }
+    tail = previousNode;
 }
 
 // Destructor
-template <class T>
-DoublyLinkedList<T>::~DoublyLinkedList()
+template <class T, class SizePolicy, class AccessPolicy>
+DoublyLinkedList<T, SizePolicy, AccessPolicy>::~DoublyLinkedList()
 {
-    Node<T>* curr = head;
-    while (curr != nullptr) 
-    {
-        Node<T>* temp = curr->next;
-        delete curr;
-        curr = temp;
-    }
-    
-    head = tail = nullptr;
-    count = 0;
+    clear();
 }
 
 #endif
\ No newline at end of file
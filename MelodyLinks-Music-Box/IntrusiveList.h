@@ -0,0 +1,280 @@
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+#include <vector>
+
+/*
+    Author: Ky Lam
+    Date: October 18, 2026
+    Description: An intrusive doubly linked list. Instead of wrapping every item in a Node,
+    the items carry their own links by deriving from IntrusiveHook, so linking an item costs
+    no allocation and an item can be unlinked in O(1) from a reference to it.
+    The list never owns its items: they live wherever the caller keeps them (an array, an arena,
+    a library of songs) and must stay at the same address while they are linked.
+    An item can be on one IntrusiveList at a time. Destroying a linked item unlinks it first,
+    so an item that a growing vector moves elsewhere drops off its list instead of leaving it dangling.
+    Copying an item never copies its links: a copy starts unlinked, and assigning to a linked
+    item changes its data but leaves it where it is in the list.
+*/
+
+template <class T>
+class IntrusiveList;
+
+template <class T>
+class IntrusiveHook
+{
+    private:
+        friend class IntrusiveList<T>;
+
+        T* hookNext;                    // The following item in the list.
+        T* hookPrevious;                // The preceding item in the list.
+        IntrusiveList<T>* hookList;     // The list the item is on, nullptr if it is unlinked.
+
+    public:
+        // Constructor: an item starts unlinked.
+        IntrusiveHook(): hookNext(nullptr), hookPrevious(nullptr), hookList(nullptr)
+        {
+        }
+
+        // A copy starts unlinked.
+        IntrusiveHook(const IntrusiveHook<T>&): hookNext(nullptr), hookPrevious(nullptr), hookList(nullptr)
+        {
+        }
+
+        // Assignment keeps the links of the item assigned to.
+        IntrusiveHook<T>& operator=(const IntrusiveHook<T>&)
+        {
+            return *this;
+        }
+
+        // Destructor: an item destroyed while linked is unlinked, so its list never points at freed memory.
+        // By now the T part of the item is already destroyed, so only the hook itself is handed to the list.
+        ~IntrusiveHook()
+        {
+            if (hookList != nullptr)
+            {
+                hookList->unlink(*this);
+            }
+        }
+
+        // Check if the item is on a list.
+        bool isLinked() const
+        {
+            return hookList != nullptr;
+        }
+};
+
+template <class T>
+class IntrusiveList
+{
+    private:
+        friend class IntrusiveHook<T>;
+
+        T* head;        // Pointer to the head (start) of the list.
+        T* tail;        // Pointer to the tail (last) of the list.
+        int count;      // Number of items in the list.
+
+        // Unlink the hook of an item of this list, without ever forming a reference to the item itself.
+        T* unlink(IntrusiveHook<T>& removeHook);
+
+    public:
+        typedef T* Position;    // An item of the list, nullptr for none.
+
+        // Constructor: Initializes an empty list.
+        IntrusiveList();
+
+        // The links live in the items, so a list can be neither copied nor assigned.
+        IntrusiveList(const IntrusiveList<T>&) = delete;
+        IntrusiveList<T>& operator=(const IntrusiveList<T>&) = delete;
+
+        // Link an item at the end of the list.
+        bool push_back(T& newItem);
+
+        // Unlink an item from the list without searching for it.
+        T* erase(T& removeItem);
+
+        // Link the items of the list into a new order.
+        void relink(const std::vector<T*>& order);
+
+        // Unlink all items from the list.
+        void clear();
+
+        // Get the current size of the list.
+        int getSize() const;
+
+        // Check if an item is on this list.
+        bool contains(const T& checkItem) const;
+
+        // Destructor: Unlinks all items, which stay alive.
+        ~IntrusiveList();
+
+        // Helper methods: first and last items, and the items around a given one.
+        T* getHead() const
+        {
+            return head;
+        }
+        T* getTail() const
+        {
+            return tail;
+        }
+        T* next(T* item) const
+        {
+            return item->hookNext;
+        }
+        T* previous(T* item) const
+        {
+            return item->hookPrevious;
+        }
+};
+
+// Constructor
+template <class T>
+IntrusiveList<T>::IntrusiveList(): head(nullptr), tail(nullptr), count(0)
+{
+}
+
+// Link an item at the end of the list.
+// Parameters:
+//   - newItem: The item to link. It must stay at the same address while it is linked.
+// Returns: True if the item was linked, false if it already is on a list.
+template <class T>
+bool IntrusiveList<T>::push_back(T& newItem)
+{
+    if (newItem.hookList != nullptr)
+    {
+        return false;
+    }
+
+    newItem.hookList = this;
+    newItem.hookNext = nullptr;
+    newItem.hookPrevious = tail;
+
+    if (head == nullptr)
+    {
+        head = &newItem;
+    }
+    else
+    {
+        tail->hookNext = &newItem;
+    }
+    tail = &newItem;
+    count++;
+    return true;
+}
+
+// Unlink an item from the list.
+// Parameters:
+//   - removeItem: An item of this list.
+// Returns: The item that followed the removed one, or nullptr if it was the tail or is not on this list.
+template <class T>
+T* IntrusiveList<T>::erase(T& removeItem)
+{
+    if (removeItem.hookList != this)
+    {
+        return nullptr;
+    }
+    return unlink(removeItem);
+}
+
+// Unlink the hook of an item of this list.
+// It only reads the links of the hook and writes those of its neighbors, so the destructor of IntrusiveHook
+// can call it after the rest of the item has been destroyed.
+// Parameters:
+//   - removeHook: The hook of an item of this list.
+// Returns: The item that followed the removed one, or nullptr if it was the tail.
+template <class T>
+T* IntrusiveList<T>::unlink(IntrusiveHook<T>& removeHook)
+{
+    T* nextItem = removeHook.hookNext;
+    T* previousItem = removeHook.hookPrevious;
+
+    if (previousItem == nullptr)
+    {
+        head = nextItem;
+    }
+    else
+    {
+        previousItem->hookNext = nextItem;
+    }
+
+    if (nextItem == nullptr)
+    {
+        tail = previousItem;
+    }
+    else
+    {
+        nextItem->hookPrevious = previousItem;
+    }
+
+    removeHook.hookNext = removeHook.hookPrevious = nullptr;
+    removeHook.hookList = nullptr;
+    count--;
+    return nextItem;
+}
+
+// Link the items of the list into a new order. The items stay where they are in memory.
+// Parameters:
+//   - order: Every item of this list exactly once, in the order they should have.
+template <class T>
+void IntrusiveList<T>::relink(const std::vector<T*>& order)
+{
+    T* previousItem = nullptr;
+    for (std::size_t i = 0; i < order.size(); i++)
+    {
+        order[i]->hookPrevious = previousItem;
+        if (previousItem == nullptr)
+        {
+            head = order[i];
+        }
+        else
+        {
+            previousItem->hookNext = order[i];
+        }
+        previousItem = order[i];
+    }
+
+    if (previousItem != nullptr)
+    {
+        previousItem->hookNext = nullptr;
+    }
+    tail = previousItem;
+}
+
+// Unlink all items from the list.
+template <class T>
+void IntrusiveList<T>::clear()
+{
+    T* curr = head;
+    while (curr != nullptr)
+    {
+        T* temp = curr->hookNext;
+        curr->hookNext = curr->hookPrevious = nullptr;
+        curr->hookList = nullptr;
+        curr = temp;
+    }
+
+    head = tail = nullptr;
+    count = 0;
+}
+
+// Get the number of items in the list.
+template <class T>
+int IntrusiveList<T>::getSize() const
+{
+    return count;
+}
+
+// Check if an item is on this list, in O(1).
+template <class T>
+bool IntrusiveList<T>::contains(const T& checkItem) const
+{
+    return checkItem.hookList == this;
+}
+
+// Destructor
+template <class T>
+IntrusiveList<T>::~IntrusiveList()
+{
+    clear();
+}
+
+#endif
@@ -0,0 +1,333 @@
+#ifndef INTRUSIVE_PLAYLIST_H
+#define INTRUSIVE_PLAYLIST_H
+#include "IntrusiveList.h"
+#include "LinkedSong.h"
+#include "OutOfRangeExcept.h"
+#include "PlaylistStats.h"
+#include "Song.h"
+
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/*
+    Author: Ky Lam
+    Date: October 18, 2026
+    Description: IntrusivePlaylist is a playlist container with the same interface as DoublyLinkedList<Song>,
+    so MusicBox can use it as its playlist. The songs are kept in an arena of blocks that each hold
+    ARENA_BLOCK_SIZE songs and never grow past that, so every song keeps its address,
+    and are linked through the hooks of LinkedSong (see IntrusiveList.h).
+    A Position is a pointer to the song itself, so there is no separate node and nothing to copy out of one.
+    Removed songs are unlinked in O(1) and their arena slots are reused by later push_backs.
+*/
+
+// Songs per arena block of an IntrusivePlaylist.
+const std::size_t ARENA_BLOCK_SIZE = 1024;
+
+class IntrusivePlaylist
+{
+public:
+    typedef LinkedSong* Position;   // A song of the playlist, nullptr for none.
+
+private:
+    std::vector<std::vector<LinkedSong>> arena;     // Every song ever stored, in blocks that never reallocate.
+    std::vector<LinkedSong*> freeSongs;     // Arena slots of removed songs, waiting to be reused.
+    IntrusiveList<LinkedSong> songs;        // The songs of the playlist, in order.
+
+    // Get the song at a 1-based position.
+    LinkedSong* songAt(int position) const;
+
+public:
+    // Constructor: Initializes an empty list.
+    IntrusivePlaylist();
+
+    // Copy constructor and assignment operator: copy the songs, in order, into a fresh arena.
+    IntrusivePlaylist(const IntrusivePlaylist& other);
+    IntrusivePlaylist& operator=(const IntrusivePlaylist& other);
+
+    // Add a song to the end of the list.
+    void push_back(const Song& newItem);
+
+    // Remove a song from the list.
+    bool remove(const Song& removeItem);
+
+    // Remove every song equal to the given one in a single pass.
+    int erase_all(const Song& removeItem);
+
+    // Remove every song for which the predicate returns true in a single pass.
+    template <class Predicate>
+    int remove_if(Predicate shouldRemove);
+
+    // Unlink a song of this list in O(1) and recycle its slot.
+    LinkedSong* erase(LinkedSong* removeSong);
+
+    // Remove all songs from the list.
+    void clear();
+
+    // Get the current size of the list.
+    int getSize() const;
+
+    // Get a song at a given position.
+    Song at(int position) const;
+
+    // Check if the song is on the list.
+    bool contains(const Song& checkItem) const;
+
+    // Replace a song at a given position with a new song.
+    Song replace(int position, const Song& newItem);
+
+    // Positions of the first and last songs, and of the songs around a given one.
+    LinkedSong* getHead() const
+    {
+        return songs.getHead();
+    }
+    LinkedSong* getTail() const
+    {
+        return songs.getTail();
+    }
+    LinkedSong* next(LinkedSong* song) const
+    {
+        return songs.next(song);
+    }
+    LinkedSong* previous(LinkedSong* song) const
+    {
+        return songs.previous(song);
+    }
+
+    // Get the song at a position.
+    const LinkedSong& get(LinkedSong* song) const
+    {
+        return *song;
+    }
+
+    // Get the title or the duration of a song.
+    std::string_view getTitle(LinkedSong* song) const
+    {
+        return song->getTitle();
+    }
+    int getDuration(LinkedSong* song) const
+    {
+        return song->getDuration();
+    }
+
+    // Exchange the titles and durations of two songs, leaving both where they are in the list.
+    void swapItems(LinkedSong* first, LinkedSong* second)
+    {
+        std::swap(static_cast<Song&>(*first), static_cast<Song&>(*second));
+    }
+
+    // Link the songs into a new order, leaving every song at its address.
+    void relink(const std::vector<LinkedSong*>& order)
+    {
+        songs.relink(order);
+    }
+};
+
+// Constructor
+IntrusivePlaylist::IntrusivePlaylist()
+{
+}
+
+// Copy Constructor
+// Parameters:
+//     - other: the other IntrusivePlaylist is copied.
+IntrusivePlaylist::IntrusivePlaylist(const IntrusivePlaylist& other)
+{
+    for (LinkedSong* curr = other.getHead(); curr != nullptr; curr = other.next(curr))
+    {
+        push_back(*curr);
+    }
+}
+
+// Assignment Operator
+// Parameters:
+//     - other: the other IntrusivePlaylist is copied.
+// Returns: the new IntrusivePlaylist after copy from the other.
+IntrusivePlaylist& IntrusivePlaylist::operator=(const IntrusivePlaylist& other)
+{
+    if (this == &other)
+    {
+        return *this;
+    }
+
+    clear();
+    for (LinkedSong* curr = other.getHead(); curr != nullptr; curr = other.next(curr))
+    {
+        push_back(*curr);
+    }
+    return *this;
+}
+
+// Get the song at a 1-based position.
+// Throws: OutOfRangeExcept if the position is out of bounds.
+LinkedSong* IntrusivePlaylist::songAt(int position) const
+{
+    if (position <= 0 || position > songs.getSize())
+    {
+        throw OutOfRangeExcept();
+    }
+
+    LinkedSong* curr = songs.getHead();
+    for (int i = 1; i < position; i++)
+    {
+        curr = songs.next(curr);
+    }
+    MELODY_STATS_COUNT(LIST_NODES_TRAVERSED, position);
+    return curr;
+}
+
+// Add a song to the end of the list, reusing the slot of a removed song if there is one.
+// Parameters:
+//   - newItem: The song to be added.
+void IntrusivePlaylist::push_back(const Song& newItem)
+{
+    LinkedSong* slot;
+    if (!freeSongs.empty())
+    {
+        slot = freeSongs.back();
+        freeSongs.pop_back();
+        *slot = newItem;
+    }
+    else
+    {
+        if (arena.empty() || arena.back().size() == ARENA_BLOCK_SIZE)
+        {
+            arena.emplace_back();
+            arena.back().reserve(ARENA_BLOCK_SIZE);
+        }
+        arena.back().emplace_back(newItem);
+        slot = &arena.back().back();
+        MELODY_STATS_COUNT(LIST_NODE_ALLOCATIONS, 1);
+    }
+    MELODY_STATS_COUNT(LIST_PUSH_BACKS, 1);
+
+    songs.push_back(*slot);
+}
+
+// Remove a given song from the list.
+// Parameters:
+//   - removeItem: The song to remove.
+// Returns: True if the removal is successful, false otherwise.
+bool IntrusivePlaylist::remove(const Song& removeItem)
+{
+    for (LinkedSong* curr = songs.getHead(); curr != nullptr; curr = songs.next(curr))
+    {
+        MELODY_STATS_COUNT(LIST_NODES_TRAVERSED, 1);
+        if (*curr == removeItem)
+        {
+            erase(curr);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Remove every song equal to the given one.
+// Parameters:
+//   - removeItem: The song to remove.
+// Returns: The number of songs removed.
+int IntrusivePlaylist::erase_all(const Song& removeItem)
+{
+    return remove_if([&removeItem](const Song& song) { return song == removeItem; });
+}
+
+// Remove every song for which the predicate returns true, walking the list once.
+// Parameters:
+//   - shouldRemove: Called as shouldRemove(const Song&) once for every song.
+// Returns: The number of songs removed.
+template <class Predicate>
+int IntrusivePlaylist::remove_if(Predicate shouldRemove)
+{
+    int removed = 0;
+    LinkedSong* curr = songs.getHead();
+    while (curr != nullptr)
+    {
+        MELODY_STATS_COUNT(LIST_NODES_TRAVERSED, 1);
+        if (shouldRemove(*curr))
+        {
+            curr = erase(curr);
+            removed++;
+        }
+        else
+        {
+            curr = songs.next(curr);
+        }
+    }
+    return removed;
+}
+
+// Unlink a song of this list and recycle its arena slot.
+// Parameters:
+//   - removeSong: A song of this list.
+// Returns: The song that followed the removed one, or nullptr if it was the last one or is not on this list.
+LinkedSong* IntrusivePlaylist::erase(LinkedSong* removeSong)
+{
+    // A song of another list must not have its slot recycled into this arena.
+    if (!songs.contains(*removeSong))
+    {
+        return nullptr;
+    }
+
+    LinkedSong* nextSong = songs.erase(*removeSong);
+    freeSongs.push_back(removeSong);
+    MELODY_STATS_COUNT(LIST_NODE_DELETIONS, 1);
+    return nextSong;
+}
+
+// Remove all songs from the list and release the arena.
+void IntrusivePlaylist::clear()
+{
+    MELODY_STATS_COUNT(LIST_NODE_DELETIONS, songs.getSize());
+    songs.clear();
+    freeSongs.clear();
+    arena.clear();
+}
+
+// Get the number of songs in the list.
+int IntrusivePlaylist::getSize() const
+{
+    return songs.getSize();
+}
+
+// Get a song at a given position.
+// Parameters:
+//   - position: The position of the song to retrieve (1-based).
+// Returns: The song at the specified position.
+// Throws: OutOfRangeExcept if the position is out of bounds.
+Song IntrusivePlaylist::at(int position) const
+{
+    return *songAt(position);
+}
+
+// Check if a song equal to the given one is on the list.
+// Parameters:
+//   - checkItem: The song needs to be checked.
+// Returns: True if the song is on the list, false otherwise.
+bool IntrusivePlaylist::contains(const Song& checkItem) const
+{
+    for (LinkedSong* curr = songs.getHead(); curr != nullptr; curr = songs.next(curr))
+    {
+        MELODY_STATS_COUNT(LIST_NODES_TRAVERSED, 1);
+        if (*curr == checkItem)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Replace a song at a given position with a new song.
+// Parameters:
+//   - position: The position of the song to replace (1-based).
+//   - newItem: The new song to replace the old one.
+// Returns: The old song that was replaced.
+// Throws: OutOfRangeExcept if the position is out of bounds.
+Song IntrusivePlaylist::replace(int position, const Song& newItem)
+{
+    LinkedSong* curr = songAt(position);
+    Song oldEntry = *curr;
+    *curr = newItem;
+    return oldEntry;
+}
+
+#endif
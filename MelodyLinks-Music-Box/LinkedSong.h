@@ -0,0 +1,31 @@
+#ifndef LINKED_SONG_H
+#define LINKED_SONG_H
+#include "IntrusiveList.h"
+#include "Song.h"
+
+/*
+    Author: Ky Lam
+    Date: October 18, 2026
+    Description: A LinkedSong is a Song that also carries the links of an IntrusiveList,
+    so it can be put on a playlist without a separate node. Only the intrusive mode pays
+    for the three extra pointers: a plain Song, and every Node<Song>, stays as it was.
+    Copying or assigning a LinkedSong moves its title and duration, never its links.
+*/
+
+class LinkedSong : public Song, public IntrusiveHook<LinkedSong>
+{
+    public:
+        // Constructor: an unlinked copy of a Song.
+        LinkedSong(const Song& song) : Song(song)
+        {
+        }
+
+        // Replace the title and duration, keeping the song where it is in its list.
+        LinkedSong& operator=(const Song& song)
+        {
+            Song::operator=(song);
+            return *this;
+        }
+};
+
+#endif
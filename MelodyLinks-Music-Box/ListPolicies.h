@@ -0,0 +1,82 @@
+#ifndef LIST_POLICIES_H
+#define LIST_POLICIES_H
+
+/*
+    Author: Ky Lam
+    Date: October 18, 2026
+    Description: Policies that choose, at compile time, how a DoublyLinkedList behaves.
+    A size policy decides whether the list keeps a running count of its items:
+        TrackedSize     getSize() is O(1) and at()/replace() can reject a bad position before walking.
+        UntrackedSize   the list is one int smaller and push_back/remove do no bookkeeping,
+                        but getSize() walks the whole list.
+    An access policy decides whether at() and replace() check the position:
+        CheckedAccess   an invalid position throws OutOfRangeExcept.
+        UncheckedAccess the position is trusted, an invalid one is undefined behavior.
+    The list derives from its size policy, so an UntrackedSize adds nothing to its size.
+    The policies are only inspected with if constexpr, so the unused branches are never compiled in.
+*/
+
+// The list keeps a running count of its items.
+class TrackedSize
+{
+private:
+    int count;      // Number of items in the list.
+
+protected:
+    static const bool tracksSize = true;
+
+    TrackedSize(): count(0)
+    {
+    }
+    void countAdded()
+    {
+        count++;
+    }
+    void countRemoved()
+    {
+        count--;
+    }
+    void resetCount()
+    {
+        count = 0;
+    }
+    int countedSize() const
+    {
+        return count;
+    }
+};
+
+// The list does not count its items.
+class UntrackedSize
+{
+protected:
+    static const bool tracksSize = false;
+
+    void countAdded()
+    {
+    }
+    void countRemoved()
+    {
+    }
+    void resetCount()
+    {
+    }
+    int countedSize() const
+    {
+        return 0;
+    }
+};
+
+// at() and replace() throw OutOfRangeExcept for an invalid position.
+struct CheckedAccess
+{
+    static const bool checksAccess = true;
+};
+
+// at() and replace() trust the position they are given.
+struct UncheckedAccess
+{
+    static const bool checksAccess = false;
+};
+
+#endif
@@ -1,7 +1,10 @@
 #include "DoublyLinkedList.h"
 #include "MusicBox.h"
+#include "PlaylistProtocol.h"
+#include "PlaylistServer.h"
 #include "Song.h"
 
+#include <cstring>
 #include <iostream>
 #include <string>
 
@@ -12,15 +15,38 @@
     user-friendly interface for managing a playlist of songs. Utilizing the MusicBox class, 
     this program allows users to interact with their music library efficiently. 
     The menu-driven system provides various options, including adding songs to the playlist, 
-    removing songs, playing the next or previous song, viewing the currently playing song, 
+    removing songs one by one or all songs below a duration, playing the next or previous song, viewing the currently playing song, 
     displaying the entire playlist with durations, searching for specific songs, sort the playlist 
-    by song titles in alphabetical order, and exiting the application.
+    by song titles in alphabetical order, playing through the playlist for a given time, and exiting the application.
+    Started as "MelodyLinks --serve", it skips the menu and answers the line protocol from PlaylistProtocol.h
+    on standard input and output, so it can be run behind a pipe or a socket forwarder.
+    Started as "MelodyLinks --serve <path|port>", it listens on that Unix domain socket or localhost TCP port
+    instead and serves every client that connects from the same music box (Linux only).
 */
 
-int main() {
+int main(int argc, char* argv[]) {
     
     MusicBox musicBox; 
 
+    if (argc > 1 && std::strcmp(argv[1], "--serve") == 0)
+    {
+        if (argc > 2)
+        {
+#ifdef __linux__
+            return servePlaylist(musicBox, argv[2]) ? 0 : 1;
+#else
+            std::cerr << "--serve <path|port> needs Linux; run --serve alone behind a socket forwarder." << std::endl;
+            return 1;
+#endif
+        }
+
+        // Let std::cin buffer whole batches of requests and stop it from flushing std::cout before every read.
+        std::ios::sync_with_stdio(false);
+        std::cin.tie(nullptr);
+        serveProtocol(musicBox, std::cin, std::cout);
+        return 0;
+    }
+
     std::cout << "Welcome to MelodyLinks!" << std::endl;
     std::cout<<std::endl;
 
@@ -34,7 +60,9 @@ int main() {
     std::cout << "7. Search for a song" << std::endl;
     std::cout << "8. Sort the playlist" << std::endl;
     std::cout << "9. Shuffle the playlist" << std::endl;
-    std::cout << "10. Exit" << std::endl;
+    std::cout << "10. Play for a number of seconds" << std::endl;
+    std::cout << "11. Remove songs shorter than a number of seconds" << std::endl;
+    std::cout << "12. Exit" << std::endl;
 
     while (true) 
     {
@@ -118,15 +146,35 @@ int main() {
                 break;
             }
 
-            // Exit
+            // Play for a number of seconds
             case 10:
+            {
+                long long seconds;
+                std::cout << "Enter the number of seconds to play: ";
+                std::cin >> seconds;
+                musicBox.playFor(seconds);
+                break;
+            }
+
+            // Remove short songs
+            case 11:
+            {
+                int seconds;
+                std::cout << "Enter the minimum song duration to keep (in seconds): ";
+                std::cin >> seconds;
+                musicBox.removeSongsShorterThan(seconds);
+                break;
+            }
+
+            // Exit
+            case 12:
             {
                 std::cout << std::endl;
                 std::cout << "Thank you for using MelodyLinks!" << std::endl;
                 return false; // Exit the program
             }
 
-            // If the user inputs an invalid option (not 1 to 10), ask the user to try again.       
+            // If the user inputs an invalid option (not 1 to 12), ask the user to try again.       
             default:
                 std::cout << std::endl;
                 std::cout << "Invalid option. Please choose a valid option." << std::endl;
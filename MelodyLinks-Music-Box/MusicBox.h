@@ -1,7 +1,21 @@
 #ifndef MUSIC_BOX_H
 #define MUSIC_BOX_H
+#include "ContiguousPlaylist.h"
 #include "DoublyLinkedList.h"
+#include "IntrusivePlaylist.h"
+#include "PlaybackTimeline.h"
+#include "PlaylistStats.h"
 #include "Song.h"
+#include "TitleSort.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
 
 /*
     Author: Ky Lam
@@ -11,30 +25,66 @@
     Users can add new songs to the playlist, remove specific songs, play the next or previous song, 
     view the currently playing song, display the entire playlist with song titles and durations, 
     search for songs within the playlist, shuffle and sort the playlist by song titles in alphabetical order.
+    The container that holds the playlist is a template parameter: MusicBox keeps the songs in a
+    DoublyLinkedList<Song>, ContiguousMusicBox keeps them in the arrays of a ContiguousPlaylist,
+    and IntrusiveMusicBox links them as LinkedSongs, through their own hooks, in an IntrusivePlaylist.
 */
 
-class MusicBox
+// The algorithms MusicBox can sort the playlist with.
+enum SortMethod
 {
+    QUICK_SORT,         // Quick sort on whole titles, with the first song as the pivot.
+    TITLE_RADIX_SORT    // Multikey quicksort on the characters of the titles, see TitleSort.h.
+};
+
+template <class Playlist>
+class BasicMusicBox
+{
+public:
+    typedef typename Playlist::Position Position;   // A song in the playlist container.
+
 private:
-    DoublyLinkedList<Song> playlist;    // A doubly-linked list that stores the songs in the playlist.
-    Node<Song>* currentSongNode;        // A pointer to the currently played song in the playlist.
+    Playlist playlist;                  // The container that stores the songs in the playlist.
+    Position currentSongNode;           // The position of the currently played song in the playlist.
+    int currentSongElapsed;             // The number of seconds of the current song that have already played.
+    PlaybackTimeline<Playlist> timeline;    // The prefix-sum index used to simulate playback over time.
+    bool timelineDirty;                 // True when the playlist changed since the timeline was last rebuilt.
+    std::ostream* output;               // The stream that receives all messages, std::cout by default.
+    bool clockRunning;                  // True while wall-clock playback is running.
+    std::chrono::steady_clock::time_point clockSynced;  // The wall-clock time playback was last advanced to.
+
+    // Removes every song matching a predicate and keeps the current song on a remaining one.
+    template <class Predicate>
+    int removeSongsIf(Predicate shouldRemove);
+
+    // Rebuilds the timeline if needed and finds the point playback starts from.
+    bool startPlayback(long long seconds, PlaybackCursor& cursor);
+
+    // Moves the current song to the point playback stopped at and displays it.
+    void finishPlayback(long long seconds, const PlaybackCursor& cursor, long long trackChanges);
 
 public:
     // Constructor: initialize an empty MusicBox.
-    MusicBox();
+    BasicMusicBox();
 
     // Copy constructor: create a new MusicBox as a copy of another MusicBox.
-    MusicBox(const MusicBox& other);
+    BasicMusicBox(const BasicMusicBox<Playlist>& other);
 
     // Assignment operator: assign the contents of another MusicBox to this one.
-    MusicBox& operator=(const MusicBox& other);
+    BasicMusicBox<Playlist>& operator=(const BasicMusicBox<Playlist>& other);
 
     // Adds a new song to the playlist.
-    void addSong(const std::string& title, int duration);
+    bool addSong(const std::string& title, int duration);
 
     // Removes a song from the playlist. 
     bool removeSong(const std::string& title, bool isDestructorCall);
 
+    // Removes every song shorter than a number of seconds from the playlist.
+    int removeSongsShorterThan(int seconds);
+
+    // Removes every song whose title is in the given list from the playlist.
+    int removeSongs(const std::vector<std::string>& titles);
+
     // Check if a song in the playlist.
     bool searchSong(const std::string& title);
 
@@ -47,36 +97,77 @@ public:
     // Displays the currently playing song.
     void currentSong();
 
+    // Returns the number of seconds of the current song that have already played.
+    int getCurrentSongElapsed() const;
+
     // Displays the entire playlist with song titles and durations.
     void displayPlaylist();
 
-    // Sorts the playlist by song titles in alphabetical order using Quick Sort algorithm.
-    void sort();
+    // Sorts the playlist by song titles in alphabetical order using Quick Sort algorithm or the title radix sort.
+    void sort(SortMethod method = QUICK_SORT);
 
     // Shuffle feature: randomly reorder songs in the playlist
     void shufflePlaylist();
 
+    // Reorders the songs in the playlist the same way every time for the same seed.
+    void shufflePlaylist(unsigned int seed);
+
+    // Sends all further messages to another stream.
+    void setOutput(std::ostream& newOutput);
+
+    // Returns the stream that currently receives the messages.
+    std::ostream& getOutput() const;
+
+    // Advances gapless playback by a number of seconds, moving on to the following songs as they end.
+    void playFor(long long seconds);
+
+    // Advances gapless playback by a number of seconds and reports every song that starts along the way.
+    template <class Callback>
+    void playFor(long long seconds, Callback onTrackChange);
+
+    // Starts wall-clock playback from the current song and the current point in it.
+    void startClock();
+
+    // Stops wall-clock playback where the last syncPlayback() left it.
+    void stopClock();
+
+    // Advances playback by the whole seconds of wall-clock time since the clock started or was last synced.
+    template <class Callback>
+    void syncPlayback(Callback onTrackChange);
+
     // Destructor: clean up the MusicBox by removing all songs from the playlist.
-    ~MusicBox();
+    ~BasicMusicBox();
 };
 
+// The music box used by the MelodyLinks menu, with the playlist in a doubly linked list.
+typedef BasicMusicBox<DoublyLinkedList<Song>> MusicBox;
+
+// A music box with the playlist in contiguous arrays.
+typedef BasicMusicBox<ContiguousPlaylist> ContiguousMusicBox;
+
+// A music box with the songs linked through their own hooks, without separate nodes.
+typedef BasicMusicBox<IntrusivePlaylist> IntrusiveMusicBox;
+
 // Constructor
-MusicBox::MusicBox(): currentSongNode(nullptr) 
+template <class Playlist>
+BasicMusicBox<Playlist>::BasicMusicBox(): currentSongNode(Position()), currentSongElapsed(0), timelineDirty(true), output(&std::cout),
+    clockRunning(false)
 {
 }
 
 // Copy constructor
 // Parameters:
 //     - other: the other MusicBox is copied.
-MusicBox::MusicBox(const MusicBox& other)
+template <class Playlist>
+BasicMusicBox<Playlist>::BasicMusicBox(const BasicMusicBox<Playlist>& other): currentSongNode(Position()), currentSongElapsed(0),
+    timelineDirty(true), output(other.output), clockRunning(false)
 {
-    Node<Song>* otherCurrent = other.playlist.getHead();
-    while (otherCurrent != nullptr)
+    Position otherCurrent = other.playlist.getHead();
+    while (otherCurrent != Position())
     {
-        Song otherSong = otherCurrent->data;
-        addSong(otherSong.getTitle(), otherSong.getDuration());
+        addSong(std::string(other.playlist.getTitle(otherCurrent)), other.playlist.getDuration(otherCurrent));
 
-        otherCurrent = otherCurrent->next;
+        otherCurrent = other.playlist.next(otherCurrent);
     }
 }
 
@@ -84,7 +175,8 @@ MusicBox::MusicBox(const MusicBox& other)
 // Parameters:
 //     - other: the other MusicBox is copied.
 // Returns: the new MusicBox after copy from the other.
-MusicBox& MusicBox::operator=(const MusicBox& other)
+template <class Playlist>
+BasicMusicBox<Playlist>& BasicMusicBox<Playlist>::operator=(const BasicMusicBox<Playlist>& other)
 {
     if (this == &other)
     {
@@ -92,24 +184,19 @@ MusicBox& MusicBox::operator=(const MusicBox& other)
     }
 
     // Clear the current playlist
-    while (playlist.getSize() > 0)
-    {
-        Node<Song>* firstNode = playlist.getHead();
-
-        Song firstSong = firstNode->data;
-        std::string songTitle = firstSong.getTitle();
-
-        removeSong(songTitle, true);
-    }
+    playlist.clear();
+    currentSongNode = Position();
+    currentSongElapsed = 0;
+    timelineDirty = true;
+    clockRunning = false;
 
     // Copy Songs from other playlist to this playlist
-    Node<Song>* otherCurrent = other.playlist.getHead();
-    while (otherCurrent != nullptr)
+    Position otherCurrent = other.playlist.getHead();
+    while (otherCurrent != Position())
     {
-        Song otherSong = otherCurrent->data;
-        addSong(otherSong.getTitle(), otherSong.getDuration());
+        addSong(std::string(other.playlist.getTitle(otherCurrent)), other.playlist.getDuration(otherCurrent));
 
-        otherCurrent = otherCurrent->next;
+        otherCurrent = other.playlist.next(otherCurrent);
     }
 
     return *this;
@@ -118,24 +205,37 @@ MusicBox& MusicBox::operator=(const MusicBox& other)
 // Adds a new song to the playlist.
 // Parameters:
 //   - title: The title of the new Song.
-//   - duration: The duration of the new Song in seconds.
-// Output the message when the Song is added successfully.
-void MusicBox::addSong(const std::string& title, int duration)
+//   - duration: The duration of the new Song in seconds. A negative duration is rejected,
+//     it would make the playback timeline run backwards.
+// Returns: True if the Song is added, false otherwise.
+// Output the message when the Song is added successfully or not.
+template <class Playlist>
+bool BasicMusicBox<Playlist>::addSong(const std::string& title, int duration)
 {
-    if (currentSongNode == nullptr)
+    MELODY_STATS_TIME(ADD_SONG_LATENCY);
+    if (duration < 0)
+    {
+        *output<<"\""<< title <<"\""<< " has a negative duration. Fail to add."<< std::endl;
+        return false;
+    }
+
+    if (currentSongNode == Position())
     {
         Song newSong(title, duration);
         playlist.push_back(newSong);
 
         currentSongNode = playlist.getHead();
+        currentSongElapsed = 0;
     }
     else
     {
         Song newSong(title, duration);
         playlist.push_back(newSong);
     }
+    timelineDirty = true;
 
-    std::cout<<"\""<< title <<"\""<< " added to the playlist."<< std::endl;
+    *output<<"\""<< title <<"\""<< " added to the playlist."<< std::endl;
+    return true;
 }
 
 // Removes a song from the playlist. 
@@ -145,252 +245,540 @@ void MusicBox::addSong(const std::string& title, int duration)
 // Returns: True if the removal is successful, false otherwise.
 // Output the message when the Song is removed successfully or not.
 // If isDestructorCall is set to true, it suppresses output messages for destructor calls.
-bool MusicBox::removeSong(const std::string& removeTitle, bool isDestructorCall)
+template <class Playlist>
+bool BasicMusicBox<Playlist>::removeSong(const std::string& removeTitle, bool isDestructorCall)
 {
-    Node<Song>* current = playlist.getHead();
+    MELODY_STATS_TIME(REMOVE_SONG_LATENCY);
+    Position current = playlist.getHead();
 
-    while (current != nullptr) 
+    while (current != Position()) 
     {
-        Song currSong = current->data;
-
-        if(removeTitle == currSong.getTitle())
+        MELODY_STATS_COUNT(REMOVE_NODES_TRAVERSED, 1);
+        if(removeTitle == playlist.getTitle(current))
         {
-            if (currSong == currentSongNode->data)
+            // Compare nodes rather than Songs, an equal Song elsewhere in the playlist is not the one playing.
+            if (current == currentSongNode)
             {
                 //If NO more song in the playlist after remove
-                if (playlist.getHead()->next == nullptr)
+                if (playlist.next(playlist.getHead()) == Position())
                 {
-                    currentSongNode = nullptr;
+                    currentSongNode = Position();
                 }
                 else
                 {
-                    currentSongNode = currentSongNode->next ? currentSongNode->next : playlist.getHead();
+                    currentSongNode = playlist.next(currentSongNode) ? playlist.next(currentSongNode) : playlist.getHead();
                 }
+                currentSongElapsed = 0;
             }
+            timelineDirty = true;
             
             if (!isDestructorCall) 
             {
-                std::cout << std::endl;
-                std::cout<<"\""<<currSong.getTitle()<<"\""<< " removed from the playlist."<< std::endl;
+                *output << std::endl;
+                *output<<"\""<<playlist.getTitle(current)<<"\""<< " removed from the playlist."<< std::endl;
             }
-            return playlist.remove(currSong);
+            playlist.erase(current);
+            return true;
         }
-        current = current->next;
+        current = playlist.next(current);
     }
 
     if (!isDestructorCall)
     {
-        std::cout << std::endl;
-        std::cout<<"\""<<removeTitle<<"\""<< " is not in the playlist. Fail to remove."<< std::endl;
+        *output << std::endl;
+        *output<<"\""<<removeTitle<<"\""<< " is not in the playlist. Fail to remove."<< std::endl;
     }
     return false;
 }
 
+// Removes every song matching a predicate from the playlist in a single pass.
+// If the current song is removed, playback moves on to the next remaining song, wrapping around the playlist.
+// Parameters:
+//   - shouldRemove: Called as shouldRemove(std::string_view title, int duration) for the songs of the playlist,
+//     so no container has to build a Song to ask it.
+// Returns: The number of songs removed.
+template <class Playlist>
+template <class Predicate>
+int BasicMusicBox<Playlist>::removeSongsIf(Predicate shouldRemove)
+{
+    MELODY_STATS_TIME(REMOVE_SONGS_LATENCY);
+    auto matches = [this, &shouldRemove](Position song) { return shouldRemove(playlist.getTitle(song), playlist.getDuration(song)); };
+
+    if (currentSongNode != Position() && matches(currentSongNode))
+    {
+        Position candidate = playlist.next(currentSongNode) ? playlist.next(currentSongNode) : playlist.getHead();
+        while (candidate != currentSongNode && matches(candidate))
+        {
+            candidate = playlist.next(candidate) ? playlist.next(candidate) : playlist.getHead();
+        }
+
+        currentSongNode = candidate == currentSongNode ? Position() : candidate;
+        currentSongElapsed = 0;
+    }
+
+    // Every match is unlinked where it is found, so the walk stays O(n + k).
+    int removed = 0;
+    Position current = playlist.getHead();
+    while (current != Position())
+    {
+        MELODY_STATS_COUNT(LIST_NODES_TRAVERSED, 1);
+        if (matches(current))
+        {
+            current = playlist.erase(current);
+            removed++;
+        }
+        else
+        {
+            current = playlist.next(current);
+        }
+    }
+    if (removed > 0)
+    {
+        timelineDirty = true;
+    }
+    return removed;
+}
+
+// Removes every song shorter than a number of seconds from the playlist.
+// Parameters:
+//   - seconds: Songs whose duration is below this are removed.
+// Returns: The number of songs removed.
+// Output the number of removed songs.
+template <class Playlist>
+int BasicMusicBox<Playlist>::removeSongsShorterThan(int seconds)
+{
+    int removed = removeSongsIf([seconds](std::string_view, int duration) { return duration < seconds; });
+
+    *output << std::endl;
+    *output << removed << " songs shorter than " << seconds << " seconds removed from the playlist." << std::endl;
+    return removed;
+}
+
+// Removes every song whose title is in the given list, including all songs that share a title.
+// The titles are hashed first, so removing k titles from n songs costs O(n + k).
+// Parameters:
+//   - titles: The titles of the songs to remove.
+// Returns: The number of songs removed.
+// Output the number of removed songs.
+template <class Playlist>
+int BasicMusicBox<Playlist>::removeSongs(const std::vector<std::string>& titles)
+{
+    std::unordered_set<std::string_view> removeTitles(titles.begin(), titles.end());
+    int removed = removeSongsIf([&removeTitles](std::string_view title, int) { return removeTitles.count(title) > 0; });
+
+    *output << std::endl;
+    *output << removed << " songs removed from the playlist." << std::endl;
+    return removed;
+}
+
 // Check if the Song is on the playlist.
 // Parameters:
 //   - title: The Song's title needs to be checked.
 // Returns: True if the Song is on the playlist, false otherwise.
 // Output the message if the Song is found or not.
-bool MusicBox::searchSong(const std::string& title)
+template <class Playlist>
+bool BasicMusicBox<Playlist>::searchSong(const std::string& title)
 {
-    Node<Song>* current = playlist.getHead();
-    std::cout << std::endl;
-    while (current != nullptr) 
+    MELODY_STATS_TIME(SEARCH_SONG_LATENCY);
+    Position current = playlist.getHead();
+    *output << std::endl;
+    while (current != Position()) 
     {
-        if (current->data.getTitle() == title) 
+        MELODY_STATS_COUNT(SEARCH_NODES_TRAVERSED, 1);
+        if (playlist.getTitle(current) == title) 
         {
-            std::cout<<"Song \""<<title<<"\""<< " found in the playlist!"<< std::endl;
+            *output<<"Song \""<<title<<"\""<< " found in the playlist!"<< std::endl;
             return true;  
         }
-        current = current->next;
+        current = playlist.next(current);
     }
 
-    std::cout<<"Song \""<<title<<"\""<< " NOT found in the playlist!"<< std::endl;
+    *output<<"Song \""<<title<<"\""<< " NOT found in the playlist!"<< std::endl;
     return false;  
 }
 
 // Plays the next song in the playlist.
 // Displays the title and the duration of the new current playing Song.
-void MusicBox::playNext()
+template <class Playlist>
+void BasicMusicBox<Playlist>::playNext()
 {
-    if (currentSongNode == nullptr) 
+    if (currentSongNode == Position()) 
     {
         currentSongNode = playlist.getHead();
     } 
     else 
     {
-        currentSongNode = currentSongNode->next ? currentSongNode->next : playlist.getHead();
+        currentSongNode = playlist.next(currentSongNode) ? playlist.next(currentSongNode) : playlist.getHead();
     }
-    std::cout << std::endl;
-    std::cout<<"Now playing: \""<<currentSongNode->data.getTitle()<<"\" Duration: "<<currentSongNode->data.getDuration()<<" seconds."<< std::endl;
-
+    currentSongElapsed = 0;
+    // An empty playlist leaves currentSongNode null, currentSong() reports both cases.
+    currentSong();
 }
 
 // Plays the previous song in the playlist.
 // Displays the title and the duration of the new current playing Song.
-void MusicBox::playPrevious()
+template <class Playlist>
+void BasicMusicBox<Playlist>::playPrevious()
 {
-    if (currentSongNode == nullptr) 
+    if (currentSongNode == Position()) 
     {
         currentSongNode = playlist.getTail();
     } 
     else 
     {
-        currentSongNode = currentSongNode->previous ? currentSongNode->previous : playlist.getTail();
+        currentSongNode = playlist.previous(currentSongNode) ? playlist.previous(currentSongNode) : playlist.getTail();
     }
-    std::cout << std::endl;
-    std::cout<<"Now playing: \""<<currentSongNode->data.getTitle()<<"\" Duration: "<<currentSongNode->data.getDuration()<<" seconds."<< std::endl;
+    currentSongElapsed = 0;
+    // An empty playlist leaves currentSongNode null, currentSong() reports both cases.
+    currentSong();
 }
 
 // Displays the title and duration of currently playing Song.
-void MusicBox::currentSong()
+template <class Playlist>
+void BasicMusicBox<Playlist>::currentSong()
 {
-    if (currentSongNode == nullptr) 
+    if (currentSongNode == Position()) 
     {
-        std::cout << std::endl;
-        std::cout << "Playlist is empty, NOT playing any song now." <<std::endl;
+        *output << std::endl;
+        *output << "Playlist is empty, NOT playing any song now." <<std::endl;
     } 
     else 
     {
-        Song currSong = currentSongNode->data;
-        std::cout << std::endl;
-        std::cout << "Now playing: \"" << currSong.getTitle()<<"\" Duration: "<< currSong.getDuration()<<" seconds."<<std::endl;
+        *output << std::endl;
+        *output << "Now playing: \"" << playlist.getTitle(currentSongNode)<<"\" Duration: "<< playlist.getDuration(currentSongNode)<<" seconds."<<std::endl;
     }
 }
 
+// Returns the number of seconds of the current song that have already played, 0 if nothing is playing.
+template <class Playlist>
+int BasicMusicBox<Playlist>::getCurrentSongElapsed() const
+{
+    return currentSongElapsed;
+}
+
 // Displays the entire playlist with song titles and durations.
-void MusicBox::displayPlaylist()
+template <class Playlist>
+void BasicMusicBox<Playlist>::displayPlaylist()
 {
-    Node<Song>* current = playlist.getHead();
-    std::cout << std::endl;
-    std::cout << "Playlist:" <<endl;
+    Position current = playlist.getHead();
+    *output << std::endl;
+    *output << "Playlist:" << std::endl;
 
-    while (current != nullptr) 
+    while (current != Position()) 
     {
-        Song currSong = current->data;
-        std::cout << currSong.getTitle() << " - " << currSong.getDuration() << " seconds" << std::endl;
-        current = current->next;
+        *output << playlist.getTitle(current) << " - " << playlist.getDuration(current) << " seconds" << std::endl;
+        current = playlist.next(current);
     }
 }
 
 // Helper function (Quick Sort) for the sort method.
 // Parameters:
 //   - playlist: The playlist need to be sorted.
-//   - low: The pointer to the first Song of the playlist.
-//   - high: The pointer to the last Song of the playlist.
-void quickSort(DoublyLinkedList<Song>& playlist, Node<Song>* low, Node<Song>* high)
+//   - low: The position of the first Song of the playlist.
+//   - high: The position of the last Song of the playlist.
+template <class Playlist>
+void quickSort(Playlist& playlist, typename Playlist::Position low, typename Playlist::Position high)
 {
-    if (low != nullptr && high != nullptr && low != high && low->previous != high)
+    typedef typename Playlist::Position Position;
+    MELODY_STATS_COUNT(QUICK_SORT_CALLS, 1);
+    MELODY_STATS_DEPTH(QUICK_SORT_MAX_DEPTH);
+    if (low != Position() && high != Position() && low != high && playlist.previous(low) != high)
     {
-        Node<Song>* pivot = low;
-        Node<Song>* left = low;
-        Node<Song>* right = high;
+        Position pivot = low;
+        Position left = low;
+        Position right = high;
         int pivotIsLeftPrevious = 0;
 
         while(left != right)
         {
             // Move left while the title is less than or equal to the pivot's title
-            while (left != nullptr && left->data.getTitle() <= pivot->data.getTitle() && left != right)
-                left = left->next;
+            while (left != Position() && playlist.getTitle(left) <= playlist.getTitle(pivot) && left != right)
+                left = playlist.next(left);
 
             // Move right while the title is greater than the pivot's title
-            while (right != nullptr && right->data.getTitle() > pivot->data.getTitle() && left != right)
-                right = right->previous;
+            while (right != Position() && playlist.getTitle(right) > playlist.getTitle(pivot) && left != right)
+                right = playlist.previous(right);
 
             //Swap pivot
             if(left == right) 
             {
-                if (pivot->data < left->data)
+                if (playlist.getTitle(pivot) < playlist.getTitle(left))
                 {
-                    std::swap(pivot->data, left->previous->data);
+                    playlist.swapItems(pivot, playlist.previous(left));
+                    MELODY_STATS_COUNT(QUICK_SORT_SWAPS, 1);
                     pivotIsLeftPrevious = 1;
                 }
                 else
                 {
-                    std::swap(pivot->data, left->data);
+                    playlist.swapItems(pivot, left);
+                    MELODY_STATS_COUNT(QUICK_SORT_SWAPS, 1);
                     pivotIsLeftPrevious = 0;
                 }
             }
             // Swap nodes  
-            else if (left != nullptr && right != nullptr && left != right)
+            else if (left != Position() && right != Position() && left != right)
             {
                 // Swap left and right elements
-                std::swap(left->data, right->data);
+                playlist.swapItems(left, right);
+                MELODY_STATS_COUNT(QUICK_SORT_SWAPS, 1);
             }
         }
 
         // Recursively sort the two sublists
-        if(left->previous != nullptr && pivotIsLeftPrevious == 0)
+        // Check pivotIsLeftPrevious first, so previous() is never asked for the node before the head.
+        if(pivotIsLeftPrevious == 0 && playlist.previous(left) != Position())
         {
-            quickSort(playlist, low, left->previous);
+            quickSort(playlist, low, playlist.previous(left));
         }
         else 
-        if(left->previous->previous != nullptr && pivotIsLeftPrevious == 1)
+        if(pivotIsLeftPrevious == 1 && playlist.previous(left) != Position()
+           && playlist.previous(playlist.previous(left)) != Position())
         {
-            quickSort(playlist, low, left->previous->previous);
+            quickSort(playlist, low, playlist.previous(playlist.previous(left)));
         }
         
         quickSort(playlist, right, high);
     }
 }
 
-// Sorts the playlist by song titles in alphabetical order by using the Quick Sort algorithm.
-void MusicBox::sort()
+// Sorts the playlist by song titles in alphabetical order.
+// Parameters:
+//   - method: QUICK_SORT for the Quick Sort algorithm, TITLE_RADIX_SORT for the multikey quicksort,
+//     which relinks the songs instead of moving them and is faster on every title distribution
+//     of bench/TitleSortBench.cpp, most of all when many titles share long prefixes.
+// The current song stays at its position in the playlist, with either method.
+template <class Playlist>
+void BasicMusicBox<Playlist>::sort(SortMethod method)
 {
+    MELODY_STATS_TIME(SORT_LATENCY);
     if (playlist.getSize() <= 1)
     {
         return;
     }
 
-    Node<Song>* low = playlist.getHead();
-    Node<Song>* high = playlist.getTail();
+    Position low = playlist.getHead();
+    Position high = playlist.getTail();
 
-    quickSort(playlist, low, high);
+    if (method == TITLE_RADIX_SORT)
+    {
+        // The title sort relinks the songs instead of swapping them, so the current position would follow
+        // its song. Put it back at the same place in the playlist, as after a quick sort.
+        int currentIndex = 0;
+        for (Position current = low; current != currentSongNode; current = playlist.next(current))
+        {
+            currentIndex++;
+        }
+        titleSort(playlist);
+        if (currentSongNode != Position())
+        {
+            currentSongNode = playlist.getHead();
+            for (int i = 0; i < currentIndex; i++)
+            {
+                currentSongNode = playlist.next(currentSongNode);
+            }
+        }
+    }
+    else
+    {
+        quickSort(playlist, low, high);
+    }
+    currentSongElapsed = 0;
+    timelineDirty = true;
 
-    std::cout << std::endl;
-    std::cout << "Playlist sorted by song titles." << std::endl;
+    *output << std::endl;
+    *output << "Playlist sorted by song titles." << std::endl;
 }
 
 // Randomly reorder songs in the playlist.
-void MusicBox::shufflePlaylist() 
+template <class Playlist>
+void BasicMusicBox<Playlist>::shufflePlaylist() 
+{
+    shufflePlaylist(static_cast<unsigned>(std::time(nullptr)));
+}
+
+// Reorders the songs in the playlist with a seeded shuffle, so every kind of MusicBox holding the same songs
+// ends up in the same order. The current song stays at its position in the playlist.
+// Parameters:
+//   - seed: The seed of std::rand for the shuffle.
+template <class Playlist>
+void BasicMusicBox<Playlist>::shufflePlaylist(unsigned int seed)
 {
-    std::srand(static_cast<unsigned>(std::time(nullptr)));
-    int listSize = playlist.getSize();
+    MELODY_STATS_TIME(SHUFFLE_LATENCY);
+    std::srand(seed);
 
-    for (int i = listSize - 1; i > 0; --i) {
+    // Collect the positions once, so every swap below is O(1) instead of a walk from the head.
+    std::vector<Position> positions;
+    positions.reserve(playlist.getSize());
+    for (Position current = playlist.getHead(); current != Position(); current = playlist.next(current))
+    {
+        positions.push_back(current);
+    }
+    MELODY_STATS_COUNT(SHUFFLE_NODES_TRAVERSED, positions.size());
+
+    for (int i = static_cast<int>(positions.size()) - 1; i > 0; --i) {
         int j = std::rand() % (i + 1);
 
         // Swap songs at index i and j.
         if (i != j) {
-            Node<Song>* node1 = playlist.getHead();
-            Node<Song>* node2 = playlist.getHead();
+            playlist.swapItems(positions[i], positions[j]);
+        }
+    }
+    currentSongElapsed = 0;
+    timelineDirty = true;
+    *output << std::endl;
+    *output << "Playlist shuffled randomly." << std::endl;
+}
 
-            for (int k = 0; k < i; ++k) {
-                node1 = node1->next;
-            }
-            for (int k = 0; k < j; ++k) {
-                node2 = node2->next;
-            }
+// Sends all further messages to another stream.
+// Parameters:
+//   - newOutput: The stream to write to. It must outlive the MusicBox or be replaced first.
+template <class Playlist>
+void BasicMusicBox<Playlist>::setOutput(std::ostream& newOutput)
+{
+    output = &newOutput;
+}
 
-            std::swap(node1->data, node2->data);
-        }
+// Returns the stream that currently receives the messages.
+template <class Playlist>
+std::ostream& BasicMusicBox<Playlist>::getOutput() const
+{
+    return *output;
+}
+
+// Rebuilds the timeline if the playlist changed and finds the point playback starts from.
+// Parameters:
+//   - seconds: The number of seconds to play.
+//   - cursor: Receives the current song on the timeline and the part of it already played.
+// Returns: False if there is nothing to play, after displaying the current song.
+template <class Playlist>
+bool BasicMusicBox<Playlist>::startPlayback(long long seconds, PlaybackCursor& cursor)
+{
+    if (currentSongNode == Position() || seconds <= 0)
+    {
+        currentSong();
+        return false;
+    }
+
+    if (timelineDirty)
+    {
+        timeline.rebuild(playlist);
+        timelineDirty = false;
+    }
+
+    if (timeline.getTotalDuration() <= 0)
+    {
+        currentSong();
+        return false;
+    }
+
+    cursor.index = timeline.indexOf(currentSongNode);
+    cursor.elapsed = currentSongElapsed;
+    return true;
+}
+
+// Moves the current song to the point playback stopped at.
+// Parameters:
+//   - seconds: The number of seconds played.
+//   - cursor: The point playback stopped at.
+//   - trackChanges: The number of songs started along the way.
+// Displays the title and the duration of the song playing afterwards.
+template <class Playlist>
+void BasicMusicBox<Playlist>::finishPlayback(long long seconds, const PlaybackCursor& cursor, long long trackChanges)
+{
+    currentSongNode = timeline.getSong(cursor.index);
+    currentSongElapsed = static_cast<int>(cursor.elapsed);
+
+    *output << std::endl;
+    *output << "Played " << seconds << " seconds with " << trackChanges << " track changes." << std::endl;
+    *output << "Now playing: \"" << playlist.getTitle(currentSongNode) << "\" Duration: " << playlist.getDuration(currentSongNode)
+              << " seconds, " << currentSongElapsed << " seconds in." << std::endl;
+}
+
+// Advances gapless playback by a number of seconds.
+// Parameters:
+//   - seconds: The number of seconds to play. Songs that end during this time are followed
+//     by the next song in the playlist, wrapping around to the first one. Nothing plays if it is not positive.
+// The track changes are counted in O(log n) without visiting the songs in between.
+// Displays the title and the duration of the song playing afterwards.
+template <class Playlist>
+void BasicMusicBox<Playlist>::playFor(long long seconds)
+{
+    MELODY_STATS_TIME(PLAY_FOR_LATENCY);
+    PlaybackCursor cursor;
+    if (!startPlayback(seconds, cursor))
+    {
+        return;
     }
-    std::cout << std::endl;
-    std::cout << "Playlist shuffled randomly." << std::endl;
+
+    long long trackChanges = timeline.advance(cursor, seconds);
+    finishPlayback(seconds, cursor, trackChanges);
 }
 
-// Destructor:
-MusicBox::~MusicBox()
+// Advances gapless playback by a number of seconds and reports every song that starts along the way.
+// Parameters:
+//   - seconds: The number of seconds to play.
+//   - onTrackChange: Called as onTrackChange(std::string_view title, int duration, long long offset) for every song
+//     that starts, in playback order, with offset the number of seconds into this call at which it starts.
+//     The title is only valid during the call.
+// Displays the title and the duration of the song playing afterwards.
+template <class Playlist>
+template <class Callback>
+void BasicMusicBox<Playlist>::playFor(long long seconds, Callback onTrackChange)
 {
-    while (playlist.getSize() > 0)
+    MELODY_STATS_TIME(PLAY_FOR_LATENCY);
+    PlaybackCursor cursor;
+    if (!startPlayback(seconds, cursor))
     {
-        Node<Song>* firstNode = playlist.getHead();
+        return;
+    }
 
-        Song firstSong = firstNode->data;
-        std::string songTitle = firstSong.getTitle();
+    long long trackChanges = timeline.simulate(playlist, cursor, seconds, onTrackChange);
+    finishPlayback(seconds, cursor, trackChanges);
+}
 
-        removeSong(songTitle, true);
+// Starts wall-clock playback from the current song and the current point in it.
+template <class Playlist>
+void BasicMusicBox<Playlist>::startClock()
+{
+    clockRunning = true;
+    clockSynced = std::chrono::steady_clock::now();
+}
+
+// Stops wall-clock playback. Time that passed since the last syncPlayback() is not played.
+template <class Playlist>
+void BasicMusicBox<Playlist>::stopClock()
+{
+    clockRunning = false;
+}
+
+// Advances playback by the whole seconds of wall-clock time that passed since the clock started
+// or was last synced. The fraction of a second left over is kept for the next call.
+// Parameters:
+//   - onTrackChange: Called as in playFor() for every song that starts along the way.
+// Does nothing if the clock is not running or less than a second passed.
+template <class Playlist>
+template <class Callback>
+void BasicMusicBox<Playlist>::syncPlayback(Callback onTrackChange)
+{
+    if (!clockRunning)
+    {
+        return;
+    }
+
+    std::chrono::seconds elapsed = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - clockSynced);
+    if (elapsed.count() > 0)
+    {
+        clockSynced += elapsed;
+        playFor(elapsed.count(), onTrackChange);
     }
 }
 
+// Destructor:
+template <class Playlist>
+BasicMusicBox<Playlist>::~BasicMusicBox()
+{
+    playlist.clear();
+    currentSongNode = Position();
+}
+
 #endif
\ No newline at end of file
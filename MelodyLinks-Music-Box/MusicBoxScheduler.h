@@ -0,0 +1,226 @@
+#ifndef MUSIC_BOX_SCHEDULER_H
+#define MUSIC_BOX_SCHEDULER_H
+#include "MusicBox.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+/*
+    Author: Ky Lam
+    Date: October 18, 2026
+    Description: The MusicBoxScheduler class is an asynchronous front end for a MusicBox.
+    Any number of client threads can submit commands; they are queued and applied in order
+    by a single owner thread, which is the only thread that ever touches the MusicBox.
+    The owner takes every queued command at once and applies the whole batch without
+    holding the queue lock, so the MusicBox itself needs no locking.
+    Every command returns a std::future that becomes ready once the command has been applied.
+    Like BasicMusicBox, the scheduler is a template over the playlist container, so every
+    MusicBox typedef has a scheduler typedef to match.
+*/
+
+template <class Playlist>
+class BasicMusicBoxScheduler
+{
+public:
+    typedef BasicMusicBox<Playlist> Box;            // The kind of MusicBox the scheduler drives.
+
+private:
+    Box& musicBox;                                  // The MusicBox owned by the scheduler thread.
+    std::deque<std::function<void()>> pending;      // Commands waiting to be applied, in submission order.
+    std::mutex queueMutex;                          // Guards pending and stopping.
+    std::condition_variable queueReady;             // Signalled when commands are queued or the scheduler stops.
+    bool stopping;                                  // True once stop() was called.
+    std::thread owner;                              // The thread that applies the commands.
+
+    // The owner thread loop: wait for commands and apply them in batches.
+    void run();
+
+public:
+    // Constructor: start the owner thread for a MusicBox.
+    explicit BasicMusicBoxScheduler(Box& box);
+
+    // The scheduler owns a thread, so it can be neither copied nor assigned.
+    BasicMusicBoxScheduler(const BasicMusicBoxScheduler<Playlist>&) = delete;
+    BasicMusicBoxScheduler<Playlist>& operator=(const BasicMusicBoxScheduler<Playlist>&) = delete;
+
+    // Queue any command taking a MusicBox& and get a future for its result.
+    template <class Command>
+    auto submit(Command command) -> std::future<decltype(command(std::declval<Box&>()))>;
+
+    // Asynchronous versions of the MusicBox operations.
+    std::future<bool> addSong(const std::string& title, int duration);
+    std::future<bool> removeSong(const std::string& title);
+    std::future<bool> searchSong(const std::string& title);
+    std::future<void> playNext();
+    std::future<void> playPrevious();
+    std::future<void> playFor(long long seconds);
+    std::future<void> sort(SortMethod method = QUICK_SORT);
+    std::future<void> shufflePlaylist();
+
+    // Apply the commands already queued, then stop the owner thread.
+    void stop();
+
+    // Destructor: stop the scheduler after the queued commands are applied.
+    ~BasicMusicBoxScheduler();
+};
+
+// The scheduler for the MusicBox used by the MelodyLinks menu.
+typedef BasicMusicBoxScheduler<DoublyLinkedList<Song>> MusicBoxScheduler;
+
+// The scheduler for a ContiguousMusicBox.
+typedef BasicMusicBoxScheduler<ContiguousPlaylist> ContiguousMusicBoxScheduler;
+
+// The scheduler for an IntrusiveMusicBox.
+typedef BasicMusicBoxScheduler<IntrusivePlaylist> IntrusiveMusicBoxScheduler;
+
+// Constructor
+// Parameters:
+//   - box: The MusicBox to drive. It must not be used by other threads while the scheduler runs.
+template <class Playlist>
+BasicMusicBoxScheduler<Playlist>::BasicMusicBoxScheduler(Box& box): musicBox(box), stopping(false)
+{
+    owner = std::thread(&BasicMusicBoxScheduler<Playlist>::run, this);
+}
+
+// Queue a command for the owner thread.
+// Parameters:
+//   - command: A callable taking a MusicBox&. It runs on the owner thread.
+// Returns: A future holding the result of the command, or the exception it threw.
+// Throws: std::logic_error if the scheduler was stopped.
+template <class Playlist>
+template <class Command>
+auto BasicMusicBoxScheduler<Playlist>::submit(Command command) -> std::future<decltype(command(std::declval<Box&>()))>
+{
+    typedef decltype(command(std::declval<Box&>())) Result;
+
+    // std::function needs a copyable target, so the task is shared.
+    std::shared_ptr<std::packaged_task<Result()>> task = std::make_shared<std::packaged_task<Result()>>(
+        [this, command]() mutable { return command(musicBox); });
+    std::future<Result> result = task->get_future();
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (stopping)
+        {
+            throw std::logic_error("MusicBoxScheduler is stopped");
+        }
+        pending.push_back([task]() { (*task)(); });
+    }
+    queueReady.notify_one();
+    return result;
+}
+
+// Adds a new song to the playlist.
+template <class Playlist>
+std::future<bool> BasicMusicBoxScheduler<Playlist>::addSong(const std::string& title, int duration)
+{
+    return submit([title, duration](Box& box) { return box.addSong(title, duration); });
+}
+
+// Removes a song from the playlist.
+template <class Playlist>
+std::future<bool> BasicMusicBoxScheduler<Playlist>::removeSong(const std::string& title)
+{
+    return submit([title](Box& box) { return box.removeSong(title, false); });
+}
+
+// Checks if a song is in the playlist.
+template <class Playlist>
+std::future<bool> BasicMusicBoxScheduler<Playlist>::searchSong(const std::string& title)
+{
+    return submit([title](Box& box) { return box.searchSong(title); });
+}
+
+// Plays the next song in the playlist.
+template <class Playlist>
+std::future<void> BasicMusicBoxScheduler<Playlist>::playNext()
+{
+    return submit([](Box& box) { box.playNext(); });
+}
+
+// Plays the previous song in the playlist.
+template <class Playlist>
+std::future<void> BasicMusicBoxScheduler<Playlist>::playPrevious()
+{
+    return submit([](Box& box) { box.playPrevious(); });
+}
+
+// Advances gapless playback by a number of seconds.
+template <class Playlist>
+std::future<void> BasicMusicBoxScheduler<Playlist>::playFor(long long seconds)
+{
+    return submit([seconds](Box& box) { box.playFor(seconds); });
+}
+
+// Sorts the playlist by song titles.
+template <class Playlist>
+std::future<void> BasicMusicBoxScheduler<Playlist>::sort(SortMethod method)
+{
+    return submit([method](Box& box) { box.sort(method); });
+}
+
+// Randomly reorders the songs in the playlist.
+template <class Playlist>
+std::future<void> BasicMusicBoxScheduler<Playlist>::shufflePlaylist()
+{
+    return submit([](Box& box) { box.shufflePlaylist(); });
+}
+
+// The owner thread loop: wait for commands, take the whole queue and apply it as one batch.
+template <class Playlist>
+void BasicMusicBoxScheduler<Playlist>::run()
+{
+    std::deque<std::function<void()>> batch;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueReady.wait(lock, [this]() { return stopping || !pending.empty(); });
+            if (pending.empty())
+            {
+                return;
+            }
+            batch.swap(pending);
+        }
+
+        while (!batch.empty())
+        {
+            batch.front()();
+            batch.pop_front();
+        }
+    }
+}
+
+// Apply the commands already queued, then stop the owner thread.
+// Commands submitted after this call are rejected.
+template <class Playlist>
+void BasicMusicBoxScheduler<Playlist>::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+    }
+    queueReady.notify_one();
+
+    if (owner.joinable())
+    {
+        owner.join();
+    }
+}
+
+// Destructor
+template <class Playlist>
+BasicMusicBoxScheduler<Playlist>::~BasicMusicBoxScheduler()
+{
+    stop();
+}
+
+#endif
@@ -0,0 +1,317 @@
+#ifndef PLAYBACK_TIMELINE_H
+#define PLAYBACK_TIMELINE_H
+#include "OutOfRangeExcept.h"
+#include "Song.h"
+
+#include <algorithm>
+#include <climits>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/*
+    Author: Ky Lam
+    Date: October 18, 2026
+    Description: The PlaybackTimeline class indexes a playlist by the running total of its
+    song durations, so gapless playback can be simulated without walking the list.
+    The playlist loops forever: after the last song ends, the first one starts again.
+    Looking up the song playing at a given second takes O(log n) with a binary search,
+    and simulating a stretch of playback reports every track change through a callback.
+    A listener is only a PlaybackCursor, a song index and the seconds played of it, so one timeline can
+    advance any number of independent listeners over the same playlist, each in O(log n).
+    Long plays are split into whole passes through the playlist and a remainder before any time is added,
+    so no amount of seconds that fits in a long long can overflow.
+    The index holds positions in the playlist, so it must be rebuilt after the playlist changes.
+    It works with any playlist container that MusicBox accepts.
+*/
+
+// A point of playback on a PlaybackTimeline.
+struct PlaybackCursor
+{
+    int index;          // The 0-based index of the song playing.
+    long long elapsed;  // The number of seconds of that song already played.
+};
+
+template <class Playlist>
+class PlaybackTimeline
+{
+public:
+    typedef typename Playlist::Position Position;
+
+private:
+    std::vector<Position> songs;                    // The playlist positions in playback order.
+    std::vector<long long> startTimes;              // startTimes[i] is the second at which songs[i] starts; the last entry is the total duration.
+    std::unordered_map<Position, int> indexes;      // Maps every playlist position back to its index in songs.
+
+public:
+    // Constructor: initialize an empty timeline.
+    PlaybackTimeline();
+
+    // Rebuild the index from the songs currently in the playlist.
+    void rebuild(const Playlist& playlist);
+
+    // Get the number of songs on the timeline.
+    int getSize() const;
+
+    // Get the length in seconds of one pass through the playlist.
+    long long getTotalDuration() const;
+
+    // Get the 0-based index of the song playing at a given second.
+    int indexAt(long long seconds) const;
+
+    // Get the 0-based index of a playlist position.
+    int indexOf(Position songPosition) const;
+
+    // Get the position of the song at a given 0-based index.
+    Position getSong(int index) const;
+
+    // Get the second at which the song at a given 0-based index starts in the first pass.
+    long long startOf(int index) const;
+
+    // Get the position of the song playing at a given second.
+    Position songAt(long long seconds) const;
+
+    // Move a cursor forward by a number of seconds and count the songs started along the way.
+    long long advance(PlaybackCursor& cursor, long long seconds) const;
+
+    // Simulate playback between two points in time and report every track change.
+    template <class Callback>
+    long long simulate(const Playlist& playlist, long long from, long long to, Callback onTrackChange) const;
+
+    // Simulate playback from a cursor, report every track change and move the cursor to where playback stops.
+    template <class Callback>
+    long long simulate(const Playlist& playlist, PlaybackCursor& cursor, long long seconds, Callback onTrackChange) const;
+};
+
+// Constructor
+template <class Playlist>
+PlaybackTimeline<Playlist>::PlaybackTimeline(): startTimes(1, 0)
+{
+}
+
+// Rebuild the index from the songs currently in the playlist.
+// Parameters:
+//   - playlist: The playlist to index.
+template <class Playlist>
+void PlaybackTimeline<Playlist>::rebuild(const Playlist& playlist)
+{
+    songs.clear();
+    startTimes.clear();
+    indexes.clear();
+
+    songs.reserve(playlist.getSize());
+    startTimes.reserve(playlist.getSize() + 1);
+    indexes.reserve(playlist.getSize());
+
+    long long total = 0;
+    Position current = playlist.getHead();
+    while (current != Position())
+    {
+        indexes[current] = static_cast<int>(songs.size());
+        songs.push_back(current);
+        startTimes.push_back(total);
+        // A negative duration would make startTimes run backwards and break the binary search in indexAt.
+        total += std::max(0, playlist.getDuration(current));
+        current = playlist.next(current);
+    }
+    startTimes.push_back(total);
+}
+
+// Get the number of songs on the timeline.
+template <class Playlist>
+int PlaybackTimeline<Playlist>::getSize() const
+{
+    return static_cast<int>(songs.size());
+}
+
+// Get the length in seconds of one pass through the playlist.
+template <class Playlist>
+long long PlaybackTimeline<Playlist>::getTotalDuration() const
+{
+    return startTimes.back();
+}
+
+// Get the 0-based index of the song playing at a given second.
+// Parameters:
+//   - seconds: The point in time, counted from the start of the first song. It wraps around the playlist.
+// Returns: The index of the song, or -1 if the timeline has no playable duration.
+template <class Playlist>
+int PlaybackTimeline<Playlist>::indexAt(long long seconds) const
+{
+    long long total = getTotalDuration();
+    if (songs.empty() || total <= 0)
+    {
+        return -1;
+    }
+
+    long long offset = seconds % total;
+    if (offset < 0)
+    {
+        offset += total;
+    }
+
+    // The last song starting at or before offset is the one playing, which skips zero-length songs.
+    std::vector<long long>::const_iterator found = std::upper_bound(startTimes.begin(), startTimes.end() - 1, offset);
+    return static_cast<int>(found - startTimes.begin()) - 1;
+}
+
+// Get the 0-based index of a playlist position.
+// Parameters:
+//   - songPosition: The position to look up.
+// Returns: The index of the position, or -1 if it is not on the timeline.
+template <class Playlist>
+int PlaybackTimeline<Playlist>::indexOf(Position songPosition) const
+{
+    typename std::unordered_map<Position, int>::const_iterator found = indexes.find(songPosition);
+    return found == indexes.end() ? -1 : found->second;
+}
+
+// Get the position of the song at a given 0-based index.
+// Throws: OutOfRangeExcept if the index is out of bounds.
+template <class Playlist>
+typename PlaybackTimeline<Playlist>::Position PlaybackTimeline<Playlist>::getSong(int index) const
+{
+    if (index < 0 || index >= getSize())
+    {
+        throw OutOfRangeExcept();
+    }
+    return songs[index];
+}
+
+// Get the second at which the song at a given 0-based index starts in the first pass.
+// Throws: OutOfRangeExcept if the index is out of bounds.
+template <class Playlist>
+long long PlaybackTimeline<Playlist>::startOf(int index) const
+{
+    if (index < 0 || index >= getSize())
+    {
+        throw OutOfRangeExcept();
+    }
+    return startTimes[index];
+}
+
+// Get the position of the song playing at a given second.
+// Parameters:
+//   - seconds: The point in time, counted from the start of the first song.
+// Returns: The position of the song, or the empty Position if the timeline has no playable duration.
+template <class Playlist>
+typename PlaybackTimeline<Playlist>::Position PlaybackTimeline<Playlist>::songAt(long long seconds) const
+{
+    int index = indexAt(seconds);
+    return index < 0 ? Position() : songs[index];
+}
+
+// Move a cursor forward by a number of seconds and count the songs started along the way.
+// Only two binary searches are needed, however many passes through the playlist the seconds cover.
+// Parameters:
+//   - cursor: A valid point of playback on this timeline. Receives the point playback stops at.
+//   - seconds: The number of seconds to play, at least 0.
+// Returns: The number of track changes, or LLONG_MAX if there are more than a long long holds.
+template <class Playlist>
+long long PlaybackTimeline<Playlist>::advance(PlaybackCursor& cursor, long long seconds) const
+{
+    long long total = getTotalDuration();
+    if (total <= 0 || cursor.index < 0 || cursor.index >= getSize() || seconds <= 0)
+    {
+        return 0;
+    }
+
+    // Whole passes start every song once, only the remainder is added to the time within a pass.
+    long long passes = seconds / total;
+    long long endTime = startTimes[cursor.index] + cursor.elapsed + seconds % total;
+    long long changes = 0;
+    if (endTime >= total)
+    {
+        endTime -= total;
+        changes = getSize();
+    }
+
+    int endIndex = indexAt(endTime);
+    changes += endIndex - cursor.index;
+    if (passes > (LLONG_MAX - changes) / getSize())
+    {
+        changes = LLONG_MAX;
+    }
+    else
+    {
+        changes += passes * getSize();
+    }
+
+    cursor.index = endIndex;
+    cursor.elapsed = endTime - startTimes[endIndex];
+    return changes;
+}
+
+// Simulate playback between two points in time and report every track change.
+// Parameters:
+//   - playlist: The playlist the timeline was built from.
+//   - from: The point in time the simulation starts at.
+//   - to: The point in time the simulation stops at.
+//   - onTrackChange: Called as onTrackChange(std::string_view title, int duration, long long startTime) for every
+//     song that starts after 'from' and no later than 'to', in playback order.
+// Returns: The number of track changes.
+template <class Playlist>
+template <class Callback>
+long long PlaybackTimeline<Playlist>::simulate(const Playlist& playlist, long long from, long long to, Callback onTrackChange) const
+{
+    int index = indexAt(from);
+    if (index < 0 || to <= from)
+    {
+        return 0;
+    }
+
+    long long total = getTotalDuration();
+    PlaybackCursor cursor = { index, (from % total + total) % total - startTimes[index] };
+    return simulate(playlist, cursor, to - from,
+        [from, &onTrackChange](std::string_view title, int duration, long long offset) { onTrackChange(title, duration, from + offset); });
+}
+
+// Simulate playback from a cursor and report every track change.
+// Unlike the version above, songs of zero length that start right where the cursor is are reported,
+// which is what happens when a zero-length song is the one playing.
+// Parameters:
+//   - playlist: The playlist the timeline was built from.
+//   - cursor: A valid point of playback on this timeline. Receives the point playback stops at.
+//   - seconds: The number of seconds to play, at least 0.
+//   - onTrackChange: Called as onTrackChange(std::string_view title, int duration, long long offset) for every song
+//     after the one at the cursor that starts at most 'seconds' later, in playback order, with offset the number of
+//     seconds after the cursor at which it starts. The title is only valid during the call.
+// Returns: The number of track changes.
+template <class Playlist>
+template <class Callback>
+long long PlaybackTimeline<Playlist>::simulate(const Playlist& playlist, PlaybackCursor& cursor, long long seconds, Callback onTrackChange) const
+{
+    long long total = getTotalDuration();
+    if (total <= 0 || cursor.index < 0 || cursor.index >= getSize() || seconds <= 0)
+    {
+        return 0;
+    }
+
+    // passOffset is where the current pass starts, in seconds after the cursor. It is kept at most 'seconds',
+    // and the comparisons below are arranged so that none of them can overflow.
+    int index = cursor.index;
+    long long passOffset = -(startTimes[index] + cursor.elapsed);
+    while (true)
+    {
+        index++;
+        if (index == getSize())
+        {
+            if (passOffset > seconds - total)
+            {
+                break;
+            }
+            index = 0;
+            passOffset += total;
+        }
+
+        if (startTimes[index] - seconds > -passOffset)
+        {
+            break;
+        }
+        Position song = songs[index];
+        onTrackChange(playlist.getTitle(song), playlist.getDuration(song), passOffset + startTimes[index]);
+    }
+    return advance(cursor, seconds);
+}
+
+#endif
@@ -0,0 +1,232 @@
+#ifndef PLAYLIST_PROTOCOL_H
+#define PLAYLIST_PROTOCOL_H
+#include "MusicBox.h"
+#include "PlaylistStats.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+/*
+    Author: Ky Lam
+    Date: October 18, 2026
+    Description: A line protocol that lets another program drive a MusicBox through a pair of streams,
+    so MelodyLinks can run as a server behind a pipe or a socket instead of the terminal menu.
+    Every request is one line. Every response is the MusicBox messages, one line each prefixed with "- ",
+    followed by a status line that is either "OK" or "ERR <reason>"; a client reads up to the first line
+    that does not start with "- ". Requests:
+        ADD <seconds> <title>       REMOVE <title>      SEARCH <title>      REMOVE_SHORTER <seconds>
+        NEXT    PREV    CURRENT     LIST    SORT [radix]        SHUFFLE
+        PLAY <seconds>              STATS [json|prometheus]                 QUIT
+    Clients may pipeline as many requests as they like. Responses are collected in memory and
+    written out in one go once every request already received has been answered, so a batch of
+    requests costs one write instead of one per request.
+    Both functions work with every kind of MusicBox. PlaylistServer.h serves the same protocol
+    to many clients at once over a socket.
+*/
+
+// Reads the rest of a request line after the command word, without the separating spaces.
+std::string protocolArgument(std::istringstream& request)
+{
+    std::string argument;
+    std::getline(request >> std::ws, argument);
+    return argument;
+}
+
+// Runs one request line on a MusicBox.
+// Parameters:
+//   - musicBox: The MusicBox to drive. Its messages are expected to go to messages.
+//   - line: The request, without the line break.
+//   - messages: The stream that receives the statistics dumps.
+//   - status: Receives the status line, without the line break.
+// Returns: False if the request was QUIT, true otherwise.
+template <class Playlist>
+bool runProtocolCommand(BasicMusicBox<Playlist>& musicBox, const std::string& line, std::ostream& messages, std::string& status)
+{
+    std::istringstream request(line);
+    std::string command;
+    request >> command;
+
+    bool success = true;
+    if (command == "ADD")
+    {
+        int duration;
+        std::string title;
+        if (!(request >> duration) || (title = protocolArgument(request)).empty())
+        {
+            status = "ERR usage: ADD <seconds> <title>";
+            return true;
+        }
+        success = musicBox.addSong(title, duration);
+    }
+    else if (command == "REMOVE")
+    {
+        success = musicBox.removeSong(protocolArgument(request), false);
+    }
+    else if (command == "REMOVE_SHORTER")
+    {
+        int seconds;
+        if (!(request >> seconds))
+        {
+            status = "ERR usage: REMOVE_SHORTER <seconds>";
+            return true;
+        }
+        musicBox.removeSongsShorterThan(seconds);
+    }
+    else if (command == "SEARCH")
+    {
+        success = musicBox.searchSong(protocolArgument(request));
+    }
+    else if (command == "NEXT")
+    {
+        musicBox.playNext();
+    }
+    else if (command == "PREV")
+    {
+        musicBox.playPrevious();
+    }
+    else if (command == "CURRENT")
+    {
+        musicBox.currentSong();
+    }
+    else if (command == "LIST")
+    {
+        musicBox.displayPlaylist();
+    }
+    else if (command == "SORT")
+    {
+        std::string method = protocolArgument(request);
+        if (!method.empty() && method != "radix")
+        {
+            status = "ERR usage: SORT [radix]";
+            return true;
+        }
+        musicBox.sort(method == "radix" ? TITLE_RADIX_SORT : QUICK_SORT);
+    }
+    else if (command == "SHUFFLE")
+    {
+        musicBox.shufflePlaylist();
+    }
+    else if (command == "PLAY")
+    {
+        long long seconds;
+        if (!(request >> seconds))
+        {
+            status = "ERR usage: PLAY <seconds>";
+            return true;
+        }
+        musicBox.playFor(seconds);
+    }
+    else if (command == "STATS")
+    {
+        std::string format = protocolArgument(request);
+        if (format == "prometheus")
+        {
+            PlaylistStats::instance().dumpPrometheus(messages);
+        }
+        else if (format.empty() || format == "json")
+        {
+            PlaylistStats::instance().dumpJson(messages);
+        }
+        else
+        {
+            status = "ERR usage: STATS [json|prometheus]";
+            return true;
+        }
+    }
+    else if (command == "QUIT")
+    {
+        status = "OK";
+        return false;
+    }
+    else
+    {
+        status = "ERR unknown command";
+        return true;
+    }
+
+    status = success ? "OK" : "ERR failed";
+    return true;
+}
+
+// Applies one request line to a MusicBox and writes its response.
+// The MusicBox messages are collected while the request runs and framed as message lines, so a title that
+// reads like a status line cannot end a response early. The MusicBox output is restored afterwards.
+// Parameters:
+//   - musicBox: The MusicBox to drive.
+//   - line: The request, without the line break.
+//   - response: The stream that receives the message lines and the status line.
+// Returns: False if the request was QUIT, true otherwise.
+template <class Playlist>
+bool applyProtocolCommand(BasicMusicBox<Playlist>& musicBox, const std::string& line, std::ostream& response)
+{
+    static thread_local std::ostringstream messages;    // Reused, so a request does not build a stream.
+    messages.str("");
+
+    std::ostream& previousOutput = musicBox.getOutput();
+    musicBox.setOutput(messages);
+    std::string status;
+    bool serving = runProtocolCommand(musicBox, line, messages, status);
+    musicBox.setOutput(previousOutput);
+
+    // Every message line gets the "- " prefix, blank ones are only spacing for the terminal and are dropped.
+    const std::string& text = messages.str();
+    std::size_t lineStart = 0;
+    while (lineStart < text.size())
+    {
+        std::size_t lineEnd = text.find('\n', lineStart);
+        if (lineEnd == std::string::npos)
+        {
+            lineEnd = text.size();
+        }
+        if (lineEnd > lineStart)
+        {
+            response << "- ";
+            response.write(text.data() + lineStart, lineEnd - lineStart);
+            response << '\n';
+        }
+        lineStart = lineEnd + 1;
+    }
+    response << status << '\n';
+    return serving;
+}
+
+// Serves protocol requests until the input ends or a QUIT request arrives.
+// Parameters:
+//   - musicBox: The MusicBox to drive.
+//   - in: The stream the requests are read from.
+//   - out: The stream the responses are written to.
+// For the batching to pay off, in should be unsynchronized from stdio and not tied to out.
+template <class Playlist>
+void serveProtocol(BasicMusicBox<Playlist>& musicBox, std::istream& in, std::ostream& out)
+{
+    std::ostringstream batch;
+    std::string line;
+    bool serving = true;
+    while (serving && std::getline(in, line))
+    {
+        if (!line.empty() && line[line.size() - 1] == '\r')
+        {
+            line.erase(line.size() - 1);
+        }
+        if (line.empty())
+        {
+            continue;
+        }
+
+        serving = applyProtocolCommand(musicBox, line, batch);
+
+        // Only write once the client has no more requests waiting in the input buffer.
+        if (!serving || in.rdbuf()->in_avail() <= 0)
+        {
+            out << batch.str();
+            out.flush();
+            batch.str("");
+        }
+    }
+
+    out << batch.str();
+    out.flush();
+}
+
+#endif
@@ -0,0 +1,351 @@
+#ifndef PLAYLIST_SERVER_H
+#define PLAYLIST_SERVER_H
+#include "MusicBox.h"
+#include "PlaylistProtocol.h"
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/*
+    Author: Ky Lam
+    Date: October 18, 2026
+    Description: A server that answers the line protocol of PlaylistProtocol.h for any number of clients
+    at once, all driving the same MusicBox. It listens on a Unix domain socket or on a TCP port of
+    localhost and waits for every connection with one epoll instance on a single thread, so the MusicBox
+    needs no locking. Every connection has a read and a write buffer: whatever a read brings in is
+    answered in one go, and the answers go out in as few writes as the socket allows, so a client that
+    pipelines many requests pays for one read and one write per batch instead of one per request.
+    Requests from different clients are applied in the order epoll reports them.
+    A slow client cannot make the server hold unbounded memory for it: a request line longer than
+    MAX_REQUEST_LINE closes the connection, and while more than OUTPUT_HIGH_WATER bytes of responses wait
+    for a client, no more of its requests are read. Linux only.
+*/
+
+const std::size_t MAX_REQUEST_LINE = 64 * 1024;         // Longest request line a client may send, in bytes.
+const std::size_t OUTPUT_HIGH_WATER = 1024 * 1024;      // Pending response bytes above which a client's requests wait.
+
+// The state of one client connection.
+struct ProtocolConnection
+{
+    std::string input;      // Bytes received that do not form a complete request line yet.
+    std::string output;     // Responses not yet written to the socket.
+    bool closing;           // True once the client sent QUIT or closed its side.
+    std::uint32_t watching; // The epoll events currently watched for on the socket.
+
+    ProtocolConnection(): closing(false), watching(EPOLLIN)
+    {
+    }
+};
+
+// Opens a non-blocking listening socket.
+// Parameters:
+//   - address: A TCP port of localhost (1 to 65535) if it is all digits, otherwise the path of a Unix domain
+//     socket. A socket already at that path is replaced, any other kind of file is left alone and is an error.
+// Returns: The socket, or -1 after writing the reason to std::cerr.
+int openProtocolListener(const std::string& address)
+{
+    bool isPort = !address.empty() && address.find_first_not_of("0123456789") == std::string::npos;
+    long port = 0;
+    if (isPort)
+    {
+        errno = 0;
+        port = std::strtol(address.c_str(), nullptr, 10);
+        if (errno == ERANGE || port < 1 || port > 65535)
+        {
+            std::cerr << "invalid port " << address << ": must be between 1 and 65535" << std::endl;
+            return -1;
+        }
+    }
+    else
+    {
+        struct stat existing;
+        if (lstat(address.c_str(), &existing) == 0)
+        {
+            if (!S_ISSOCK(existing.st_mode))
+            {
+                std::cerr << address << " exists and is not a socket, not replacing it" << std::endl;
+                return -1;
+            }
+            unlink(address.c_str());
+        }
+        else if (errno != ENOENT)
+        {
+            std::cerr << address << ": " << std::strerror(errno) << std::endl;
+            return -1;
+        }
+    }
+
+    int listener = socket(isPort ? AF_INET : AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listener < 0)
+    {
+        std::cerr << "socket: " << std::strerror(errno) << std::endl;
+        return -1;
+    }
+
+    int bound;
+    if (isPort)
+    {
+        int reuse = 1;
+        setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        sockaddr_in local;
+        std::memset(&local, 0, sizeof(local));
+        local.sin_family = AF_INET;
+        local.sin_port = htons(static_cast<unsigned short>(port));
+        local.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bound = bind(listener, reinterpret_cast<sockaddr*>(&local), sizeof(local));
+    }
+    else
+    {
+        sockaddr_un local;
+        std::memset(&local, 0, sizeof(local));
+        local.sun_family = AF_UNIX;
+        if (address.size() >= sizeof(local.sun_path))
+        {
+            std::cerr << "socket path too long: " << address << std::endl;
+            close(listener);
+            return -1;
+        }
+        std::memcpy(local.sun_path, address.c_str(), address.size());
+        bound = bind(listener, reinterpret_cast<sockaddr*>(&local), sizeof(local));
+    }
+
+    if (bound < 0 || listen(listener, SOMAXCONN) < 0)
+    {
+        std::cerr << "listen on " << address << ": " << std::strerror(errno) << std::endl;
+        close(listener);
+        return -1;
+    }
+    return listener;
+}
+
+// Writes as much of a connection's pending responses as the socket takes without blocking.
+// Returns: False if the connection failed and must be closed.
+bool flushProtocolConnection(int client, ProtocolConnection& connection)
+{
+    std::size_t written = 0;
+    while (written < connection.output.size())
+    {
+        ssize_t sent = send(client, connection.output.data() + written, connection.output.size() - written, MSG_NOSIGNAL);
+        if (sent < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                break;
+            }
+            return false;
+        }
+        written += sent;
+    }
+    connection.output.erase(0, written);
+    return true;
+}
+
+// Answers the complete request lines a connection has buffered, until its pending responses pass OUTPUT_HIGH_WATER.
+// The lines left over wait in the input buffer until the client has read enough of the responses.
+// Parameters:
+//   - musicBox: The MusicBox to drive.
+//   - connection: The buffers of the connection.
+//   - batch: Collects the responses of this call.
+template <class Playlist>
+void answerProtocolConnection(BasicMusicBox<Playlist>& musicBox, ProtocolConnection& connection, std::ostringstream& batch)
+{
+    batch.str("");
+    std::size_t lineStart = 0;
+    std::size_t lineEnd;
+    while (connection.output.size() + static_cast<std::size_t>(batch.tellp()) < OUTPUT_HIGH_WATER
+        && (lineEnd = connection.input.find('\n', lineStart)) != std::string::npos)
+    {
+        std::string line = connection.input.substr(lineStart, lineEnd - lineStart);
+        lineStart = lineEnd + 1;
+        if (!line.empty() && line[line.size() - 1] == '\r')
+        {
+            line.erase(line.size() - 1);
+        }
+        if (!line.empty() && !applyProtocolCommand(musicBox, line, batch))
+        {
+            // QUIT: answer it, then drop whatever else the client sent.
+            connection.closing = true;
+            lineStart = connection.input.size();
+            break;
+        }
+    }
+    connection.input.erase(0, lineStart);
+    connection.output += batch.str();
+
+    if (connection.input.size() > MAX_REQUEST_LINE && connection.input.find('\n') == std::string::npos)
+    {
+        connection.output += "ERR request line too long\n";
+        connection.input.clear();
+        connection.closing = true;
+    }
+}
+
+// Reads what a client has sent and answers it, until the socket has nothing more, the client is done,
+// or its pending responses pass OUTPUT_HIGH_WATER.
+// Parameters:
+//   - musicBox: The MusicBox to drive.
+//   - client: The socket of the connection.
+//   - connection: The buffers of the connection.
+//   - batch: Collects the responses of one read.
+// Returns: False if the connection failed and must be closed.
+template <class Playlist>
+bool readProtocolConnection(BasicMusicBox<Playlist>& musicBox, int client, ProtocolConnection& connection, std::ostringstream& batch)
+{
+    char buffer[65536];
+    while (!connection.closing && connection.output.size() < OUTPUT_HIGH_WATER)
+    {
+        ssize_t received = recv(client, buffer, sizeof(buffer), 0);
+        if (received == 0)
+        {
+            connection.closing = true;
+            break;
+        }
+        if (received < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        connection.input.append(buffer, received);
+        answerProtocolConnection(musicBox, connection, batch);
+    }
+    return true;
+}
+
+// Serves the line protocol to every client of a socket until waiting on it fails.
+// Parameters:
+//   - musicBox: The MusicBox all clients drive.
+//   - address: A TCP port of localhost if it is all digits, otherwise the path of a Unix domain socket.
+// Returns: False if the socket could not be set up or waiting on it failed, after writing the reason to std::cerr.
+template <class Playlist>
+bool servePlaylist(BasicMusicBox<Playlist>& musicBox, const std::string& address)
+{
+    int listener = openProtocolListener(address);
+    if (listener < 0)
+    {
+        return false;
+    }
+
+    int poller = epoll_create1(EPOLL_CLOEXEC);
+    epoll_event watch;
+    std::memset(&watch, 0, sizeof(watch));
+    watch.events = static_cast<std::uint32_t>(EPOLLIN);
+    watch.data.fd = listener;
+    epoll_ctl(poller, EPOLL_CTL_ADD, listener, &watch);
+
+    std::ostringstream batch;
+
+    std::unordered_map<int, ProtocolConnection> connections;
+    epoll_event events[64];
+    while (true)
+    {
+        int ready = epoll_wait(poller, events, 64, -1);
+        if (ready < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            std::cerr << "epoll_wait: " << std::strerror(errno) << std::endl;
+            break;
+        }
+
+        for (int i = 0; i < ready; i++)
+        {
+            int fd = events[i].data.fd;
+            if (fd == listener)
+            {
+                int client;
+                while ((client = accept4(listener, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0)
+                {
+                    int noDelay = 1;
+                    setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+                    watch.events = static_cast<std::uint32_t>(EPOLLIN);
+                    watch.data.fd = client;
+                    epoll_ctl(poller, EPOLL_CTL_ADD, client, &watch);
+                    connections[client] = ProtocolConnection();
+                }
+                continue;
+            }
+
+            ProtocolConnection& connection = connections[fd];
+            bool healthy = (events[i].events & EPOLLERR) == 0;
+            if (healthy && (events[i].events & (EPOLLIN | EPOLLHUP)) != 0)
+            {
+                healthy = readProtocolConnection(musicBox, fd, connection, batch);
+            }
+            // Once responses went out, answer the requests that waited for room, for as long as there is room.
+            while (healthy)
+            {
+                healthy = flushProtocolConnection(fd, connection);
+                if (connection.output.size() >= OUTPUT_HIGH_WATER || connection.input.find('\n') == std::string::npos)
+                {
+                    break;
+                }
+                answerProtocolConnection(musicBox, connection, batch);
+            }
+
+            if (!healthy || (connection.closing && connection.output.empty()))
+            {
+                epoll_ctl(poller, EPOLL_CTL_DEL, fd, nullptr);
+                close(fd);
+                connections.erase(fd);
+                continue;
+            }
+
+            // Read only while the client is still sending and its responses are not piling up,
+            // and ask for room to write only while there is something left to write.
+            std::uint32_t wanted = 0;
+            if (!connection.closing && connection.output.size() < OUTPUT_HIGH_WATER)
+            {
+                wanted |= static_cast<std::uint32_t>(EPOLLIN);
+            }
+            if (!connection.output.empty())
+            {
+                wanted |= static_cast<std::uint32_t>(EPOLLOUT);
+            }
+            if (wanted != connection.watching)
+            {
+                watch.events = wanted;
+                watch.data.fd = fd;
+                epoll_ctl(poller, EPOLL_CTL_MOD, fd, &watch);
+                connection.watching = wanted;
+            }
+        }
+    }
+
+    for (std::unordered_map<int, ProtocolConnection>::iterator it = connections.begin(); it != connections.end(); ++it)
+    {
+        close(it->first);
+    }
+    close(poller);
+    close(listener);
+    return false;
+}
+
+#endif
+#endif
@@ -0,0 +1,462 @@
+#ifndef PLAYLIST_STATS_H
+#define PLAYLIST_STATS_H
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+/*
+    Author: Ky Lam
+    Date: October 18, 2026
+    Description: Optional instrumentation for DoublyLinkedList and MusicBox.
+    Building with MELODYLINKS_STATS defined turns on counters for list operations, node allocations
+    and nodes walked, the deepest quick sort recursion, and latency histograms for the MusicBox operations.
+    Without it, the MELODY_STATS_* macros expand to nothing, so the instrumented code compiles to the
+    same thing as before. The values can be dumped as JSON or in the Prometheus text format either way;
+    a build without instrumentation reports that it is disabled.
+    Every thread records into a block of its own, so MusicBoxes driven by different scheduler threads
+    never write to the same counter. The blocks hold relaxed atomics that only their thread writes,
+    which lets a dump from any thread read them while they change; the dump adds up every block,
+    including the totals of threads that have already exited.
+*/
+
+// The counters, each one a running total.
+enum StatsCounter
+{
+    LIST_PUSH_BACKS,            // Items appended with push_back.
+    LIST_NODE_ALLOCATIONS,      // Nodes allocated.
+    LIST_NODE_DELETIONS,        // Nodes deleted.
+    LIST_NODES_TRAVERSED,       // Nodes visited by remove, contains, at and replace.
+    SEARCH_NODES_TRAVERSED,     // Nodes visited by MusicBox::searchSong.
+    REMOVE_NODES_TRAVERSED,     // Nodes visited by MusicBox::removeSong.
+    SHUFFLE_NODES_TRAVERSED,    // Nodes visited by MusicBox::shufflePlaylist.
+    QUICK_SORT_CALLS,           // Calls of quickSort, including the recursive ones.
+    QUICK_SORT_SWAPS,           // Songs swapped by quickSort.
+    STATS_COUNTER_COUNT
+};
+
+// The high-water marks, each one the largest value seen.
+enum StatsMaximum
+{
+    QUICK_SORT_MAX_DEPTH,       // The deepest quickSort recursion.
+    STATS_MAXIMUM_COUNT
+};
+
+// The timed operations, each one with a latency histogram.
+enum StatsTimer
+{
+    ADD_SONG_LATENCY,
+    REMOVE_SONG_LATENCY,
+    REMOVE_SONGS_LATENCY,
+    SEARCH_SONG_LATENCY,
+    SORT_LATENCY,
+    SHUFFLE_LATENCY,
+    PLAY_FOR_LATENCY,
+    STATS_TIMER_COUNT
+};
+
+class PlaylistStats
+{
+public:
+    static const int BUCKET_COUNT = 32;     // Bucket i counts latencies in (2^(i-1), 2^i] nanoseconds, the last one everything longer.
+
+private:
+    // The values recorded by one thread. Only that thread writes them, the atomics let dumps read them any time.
+    struct ThreadStats
+    {
+        std::atomic<long long> counters[STATS_COUNTER_COUNT];                   // The running totals.
+        std::atomic<long long> maximums[STATS_MAXIMUM_COUNT];                   // The high-water marks.
+        std::atomic<long long> timerCounts[STATS_TIMER_COUNT];                  // The number of timed calls of every operation.
+        std::atomic<long long> timerTotals[STATS_TIMER_COUNT];                  // The total nanoseconds spent in every operation.
+        std::atomic<long long> timerBuckets[STATS_TIMER_COUNT][BUCKET_COUNT];   // The latency histogram of every operation.
+        int depths[STATS_MAXIMUM_COUNT];                                        // The current depth of every tracked recursion.
+
+        ThreadStats();
+
+        // Set every recorded value back to zero. The depths belong to recursions still running, so they stay.
+        void clear();
+    };
+
+    // The block of a thread, registered with the shared statistics while the thread runs.
+    struct ThreadSlot
+    {
+        ThreadStats stats;
+
+        ThreadSlot();
+        ~ThreadSlot();
+    };
+
+    // The values of every thread, added up for a dump.
+    struct Totals
+    {
+        long long counters[STATS_COUNTER_COUNT];
+        long long maximums[STATS_MAXIMUM_COUNT];
+        long long timerCounts[STATS_TIMER_COUNT];
+        long long timerTotals[STATS_TIMER_COUNT];
+        long long timerBuckets[STATS_TIMER_COUNT][BUCKET_COUNT];
+    };
+
+    mutable std::mutex threadsMutex;        // Guards threads and retired.
+    std::vector<ThreadStats*> threads;      // The blocks of the running threads.
+    ThreadStats retired;                    // The values of the threads that have exited.
+
+    // Get the block of the calling thread.
+    static ThreadStats& local()
+    {
+        static thread_local ThreadSlot slot;
+        return slot.stats;
+    }
+
+    // Add to a value only the calling thread writes. A relaxed load and store is enough, no other thread writes it.
+    static void add(std::atomic<long long>& value, long long amount)
+    {
+        value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    // Add up the blocks of every thread.
+    Totals collect() const;
+
+    // Names used in the dumps, in the order of the enums.
+    static const char* counterName(int counter);
+    static const char* maximumName(int maximum);
+    static const char* timerName(int timer);
+
+public:
+    // Constructor: start with every value at zero.
+    PlaylistStats();
+
+    // The statistics shared by all lists and music boxes.
+    static PlaylistStats& instance()
+    {
+        static PlaylistStats stats;
+        return stats;
+    }
+
+    // Add to a counter.
+    void count(StatsCounter counter, long long amount)
+    {
+        add(local().counters[counter], amount);
+    }
+
+    // Enter and leave a tracked recursion, recording how deep it went.
+    void enter(StatsMaximum maximum)
+    {
+        ThreadStats& stats = local();
+        if (++stats.depths[maximum] > stats.maximums[maximum].load(std::memory_order_relaxed))
+        {
+            stats.maximums[maximum].store(stats.depths[maximum], std::memory_order_relaxed);
+        }
+    }
+    void leave(StatsMaximum maximum)
+    {
+        --local().depths[maximum];
+    }
+
+    // Record one timed call of an operation.
+    void record(StatsTimer timer, long long nanoseconds);
+
+    // Get the current value of a counter, added up over every thread.
+    long long getCount(StatsCounter counter) const;
+
+    // Set every value back to zero.
+    void reset();
+
+    // Write every value as a JSON object.
+    void dumpJson(std::ostream& out) const;
+
+    // Write every value in the Prometheus text exposition format.
+    void dumpPrometheus(std::ostream& out) const;
+
+    // Times the enclosing scope and records it when the scope ends.
+    class ScopedTimer
+    {
+    private:
+        StatsTimer timer;
+        std::chrono::steady_clock::time_point start;
+
+    public:
+        explicit ScopedTimer(StatsTimer t): timer(t), start(std::chrono::steady_clock::now())
+        {
+        }
+        ~ScopedTimer()
+        {
+            std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+            PlaylistStats::instance().record(timer, elapsed.count());
+        }
+    };
+
+    // Tracks the recursion depth of the enclosing scope.
+    class ScopedDepth
+    {
+    private:
+        StatsMaximum maximum;
+
+    public:
+        explicit ScopedDepth(StatsMaximum m): maximum(m)
+        {
+            PlaylistStats::instance().enter(maximum);
+        }
+        ~ScopedDepth()
+        {
+            PlaylistStats::instance().leave(maximum);
+        }
+    };
+};
+
+#ifdef MELODYLINKS_STATS
+#define MELODY_STATS_COUNT(counter, amount) PlaylistStats::instance().count(counter, amount)
+#define MELODY_STATS_TIME(timer) PlaylistStats::ScopedTimer melodyStatsTimer(timer)
+#define MELODY_STATS_DEPTH(maximum) PlaylistStats::ScopedDepth melodyStatsDepth(maximum)
+#else
+#define MELODY_STATS_COUNT(counter, amount) ((void)0)
+#define MELODY_STATS_TIME(timer) ((void)0)
+#define MELODY_STATS_DEPTH(maximum) ((void)0)
+#endif
+
+// Constructor
+PlaylistStats::PlaylistStats()
+{
+}
+
+// Constructor of a thread block: every value starts at zero.
+PlaylistStats::ThreadStats::ThreadStats()
+{
+    clear();
+    for (int i = 0; i < STATS_MAXIMUM_COUNT; i++)
+    {
+        depths[i] = 0;
+    }
+}
+
+// Set every recorded value of a thread block back to zero.
+void PlaylistStats::ThreadStats::clear()
+{
+    for (int i = 0; i < STATS_COUNTER_COUNT; i++)
+    {
+        counters[i].store(0, std::memory_order_relaxed);
+    }
+    for (int i = 0; i < STATS_MAXIMUM_COUNT; i++)
+    {
+        maximums[i].store(0, std::memory_order_relaxed);
+    }
+    for (int i = 0; i < STATS_TIMER_COUNT; i++)
+    {
+        timerCounts[i].store(0, std::memory_order_relaxed);
+        timerTotals[i].store(0, std::memory_order_relaxed);
+        for (int j = 0; j < BUCKET_COUNT; j++)
+        {
+            timerBuckets[i][j].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+// Register the block of a thread the first time the thread records something.
+PlaylistStats::ThreadSlot::ThreadSlot()
+{
+    PlaylistStats& shared = PlaylistStats::instance();
+    std::lock_guard<std::mutex> lock(shared.threadsMutex);
+    shared.threads.push_back(&stats);
+}
+
+// When the thread exits, fold its values into the retired totals so the dumps keep them.
+PlaylistStats::ThreadSlot::~ThreadSlot()
+{
+    PlaylistStats& shared = PlaylistStats::instance();
+    std::lock_guard<std::mutex> lock(shared.threadsMutex);
+    for (int i = 0; i < STATS_COUNTER_COUNT; i++)
+    {
+        add(shared.retired.counters[i], stats.counters[i].load(std::memory_order_relaxed));
+    }
+    for (int i = 0; i < STATS_MAXIMUM_COUNT; i++)
+    {
+        long long maximum = std::max(shared.retired.maximums[i].load(std::memory_order_relaxed), stats.maximums[i].load(std::memory_order_relaxed));
+        shared.retired.maximums[i].store(maximum, std::memory_order_relaxed);
+    }
+    for (int i = 0; i < STATS_TIMER_COUNT; i++)
+    {
+        add(shared.retired.timerCounts[i], stats.timerCounts[i].load(std::memory_order_relaxed));
+        add(shared.retired.timerTotals[i], stats.timerTotals[i].load(std::memory_order_relaxed));
+        for (int j = 0; j < BUCKET_COUNT; j++)
+        {
+            add(shared.retired.timerBuckets[i][j], stats.timerBuckets[i][j].load(std::memory_order_relaxed));
+        }
+    }
+    shared.threads.erase(std::find(shared.threads.begin(), shared.threads.end(), &stats));
+}
+
+// Add up the values of the running threads and of the threads that have exited.
+PlaylistStats::Totals PlaylistStats::collect() const
+{
+    Totals totals = {};
+    std::lock_guard<std::mutex> lock(threadsMutex);
+
+    std::vector<const ThreadStats*> blocks(threads.begin(), threads.end());
+    blocks.push_back(&retired);
+    for (std::size_t t = 0; t < blocks.size(); t++)
+    {
+        const ThreadStats& stats = *blocks[t];
+        for (int i = 0; i < STATS_COUNTER_COUNT; i++)
+        {
+            totals.counters[i] += stats.counters[i].load(std::memory_order_relaxed);
+        }
+        for (int i = 0; i < STATS_MAXIMUM_COUNT; i++)
+        {
+            totals.maximums[i] = std::max(totals.maximums[i], stats.maximums[i].load(std::memory_order_relaxed));
+        }
+        for (int i = 0; i < STATS_TIMER_COUNT; i++)
+        {
+            totals.timerCounts[i] += stats.timerCounts[i].load(std::memory_order_relaxed);
+            totals.timerTotals[i] += stats.timerTotals[i].load(std::memory_order_relaxed);
+            for (int j = 0; j < BUCKET_COUNT; j++)
+            {
+                totals.timerBuckets[i][j] += stats.timerBuckets[i][j].load(std::memory_order_relaxed);
+            }
+        }
+    }
+    return totals;
+}
+
+// Names of the counters, in the order of StatsCounter.
+const char* PlaylistStats::counterName(int counter)
+{
+    static const char* names[STATS_COUNTER_COUNT] = {
+        "list_push_backs", "list_node_allocations", "list_node_deletions", "list_nodes_traversed",
+        "search_nodes_traversed", "remove_nodes_traversed", "shuffle_nodes_traversed",
+        "quick_sort_calls", "quick_sort_swaps"
+    };
+    return names[counter];
+}
+
+// Names of the high-water marks, in the order of StatsMaximum.
+const char* PlaylistStats::maximumName(int maximum)
+{
+    static const char* names[STATS_MAXIMUM_COUNT] = { "quick_sort_max_depth" };
+    return names[maximum];
+}
+
+// Names of the timed operations, in the order of StatsTimer.
+const char* PlaylistStats::timerName(int timer)
+{
+    static const char* names[STATS_TIMER_COUNT] = {
+        "add_song", "remove_song", "remove_songs", "search_song", "sort", "shuffle", "play_for"
+    };
+    return names[timer];
+}
+
+// Record one timed call of an operation.
+// Parameters:
+//   - timer: The operation.
+//   - nanoseconds: How long the call took.
+void PlaylistStats::record(StatsTimer timer, long long nanoseconds)
+{
+    int bucket = 0;
+    while (bucket < BUCKET_COUNT - 1 && (1LL << bucket) < nanoseconds)
+    {
+        bucket++;
+    }
+
+    ThreadStats& stats = local();
+    add(stats.timerCounts[timer], 1);
+    add(stats.timerTotals[timer], nanoseconds);
+    add(stats.timerBuckets[timer][bucket], 1);
+}
+
+// Get the current value of a counter, added up over every thread.
+long long PlaylistStats::getCount(StatsCounter counter) const
+{
+    return collect().counters[counter];
+}
+
+// Set every value of every thread back to zero.
+// A value that its thread records while this runs may survive the reset.
+void PlaylistStats::reset()
+{
+    std::lock_guard<std::mutex> lock(threadsMutex);
+    for (std::size_t t = 0; t < threads.size(); t++)
+    {
+        threads[t]->clear();
+    }
+    retired.clear();
+}
+
+// Write every value as a JSON object.
+// Timers are written with their call count, total nanoseconds and the non-empty
+// histogram buckets keyed by their upper bound in nanoseconds.
+// Parameters:
+//   - out: The stream to write to.
+void PlaylistStats::dumpJson(std::ostream& out) const
+{
+#ifdef MELODYLINKS_STATS
+    Totals totals = collect();
+    out << "{\"enabled\":true,\"counters\":{";
+    for (int i = 0; i < STATS_COUNTER_COUNT; i++)
+    {
+        out << (i > 0 ? "," : "") << "\"" << counterName(i) << "\":" << totals.counters[i];
+    }
+    for (int i = 0; i < STATS_MAXIMUM_COUNT; i++)
+    {
+        out << ",\"" << maximumName(i) << "\":" << totals.maximums[i];
+    }
+    out << "},\"timers\":{";
+    for (int i = 0; i < STATS_TIMER_COUNT; i++)
+    {
+        out << (i > 0 ? "," : "") << "\"" << timerName(i) << "\":{\"count\":" << totals.timerCounts[i]
+            << ",\"total_ns\":" << totals.timerTotals[i] << ",\"buckets\":{";
+        bool first = true;
+        for (int j = 0; j < BUCKET_COUNT; j++)
+        {
+            if (totals.timerBuckets[i][j] > 0)
+            {
+                out << (first ? "" : ",") << "\"" << (1LL << j) << "\":" << totals.timerBuckets[i][j];
+                first = false;
+            }
+        }
+        out << "}}";
+    }
+    out << "}}" << std::endl;
+#else
+    out << "{\"enabled\":false}" << std::endl;
+#endif
+}
+
+// Write every value in the Prometheus text exposition format.
+// Timers become histograms in seconds with cumulative buckets.
+// Parameters:
+//   - out: The stream to write to.
+void PlaylistStats::dumpPrometheus(std::ostream& out) const
+{
+#ifdef MELODYLINKS_STATS
+    Totals totals = collect();
+    for (int i = 0; i < STATS_COUNTER_COUNT; i++)
+    {
+        out << "# TYPE melodylinks_" << counterName(i) << "_total counter\n";
+        out << "melodylinks_" << counterName(i) << "_total " << totals.counters[i] << "\n";
+    }
+    for (int i = 0; i < STATS_MAXIMUM_COUNT; i++)
+    {
+        out << "# TYPE melodylinks_" << maximumName(i) << " gauge\n";
+        out << "melodylinks_" << maximumName(i) << " " << totals.maximums[i] << "\n";
+    }
+    out << "# TYPE melodylinks_operation_seconds histogram\n";
+    for (int i = 0; i < STATS_TIMER_COUNT; i++)
+    {
+        long long cumulative = 0;
+        for (int j = 0; j < BUCKET_COUNT - 1; j++)
+        {
+            cumulative += totals.timerBuckets[i][j];
+            out << "melodylinks_operation_seconds_bucket{operation=\"" << timerName(i) << "\",le=\""
+                << (1LL << j) / 1e9 << "\"} " << cumulative << "\n";
+        }
+        out << "melodylinks_operation_seconds_bucket{operation=\"" << timerName(i) << "\",le=\"+Inf\"} " << totals.timerCounts[i] << "\n";
+        out << "melodylinks_operation_seconds_sum{operation=\"" << timerName(i) << "\"} " << totals.timerTotals[i] / 1e9 << "\n";
+        out << "melodylinks_operation_seconds_count{operation=\"" << timerName(i) << "\"} " << totals.timerCounts[i] << "\n";
+    }
+#else
+    out << "# MelodyLinks was built without MELODYLINKS_STATS\n";
+#endif
+    out.flush();
+}
+
+#endif
@@ -19,7 +19,7 @@ class Song
         // Constructor: to initialize a Song object with a title and duration.
         Song(const std::string&, int); 
         // Returns the title of the song. 
-        std::string getTitle() const;
+        const std::string& getTitle() const;
         // Returns the duration of the song in seconds.
         int getDuration() const;
 
@@ -30,7 +30,7 @@ class Song
     }
 
     // Overloaded the operator < for comparing Song objects based on their titles.
-    bool Song::operator<(const Song& other) const
+    bool operator<(const Song& other) const
     {
         return title < other.title;
     }
@@ -42,7 +42,7 @@ Song::Song(const std::string& title, int duration) : title(title), duration(dura
 {
 }
 
-std::string Song::getTitle() const 
+const std::string& Song::getTitle() const 
 {
     return title;
 }
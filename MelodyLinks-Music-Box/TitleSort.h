@@ -0,0 +1,197 @@
+#ifndef TITLE_SORT_H
+#define TITLE_SORT_H
+#include "Song.h"
+
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/*
+    Author: Ky Lam
+    Date: October 18, 2026
+    Description: Sorts a playlist by song title with multikey quicksort (three-way radix quicksort).
+    Instead of comparing whole titles, it partitions the songs on a few characters at a time, so a prefix
+    shared by many titles ("The ...", "Symphony No. ...") is examined once per song rather than once
+    per comparison. The sort moves small keys that point at the titles where the playlist keeps them,
+    so no title is copied. Every key also caches the next seven characters of its title, so a partition
+    pass compares integers inside the key array and reads the title itself only once every seven characters.
+    The resulting order is applied with the relink() of the playlist, which only rewrites the links between
+    the songs, so no Song is copied or moved at all, however long its title.
+    It works with any playlist container that MusicBox accepts.
+*/
+
+// Ranges of this many songs or fewer are finished with an insertion sort.
+const int TITLE_SORT_INSERTION_CUTOFF = 16;
+
+// Characters cached in a key; the low byte of the cache holds how many of them the title really has.
+const std::size_t TITLE_SORT_CACHED_CHARS = 7;
+
+// A title being sorted: where its characters are, which song of the playlist it belongs to,
+// and its characters at the current depth.
+struct TitleKey
+{
+    const char* characters;     // The first character of the title, owned by the playlist.
+    std::uint32_t length;       // The length of the title.
+    std::int32_t song;          // The index of the song in playlist order.
+    std::uint64_t cache;        // The characters at [depth, depth + 7) from the high byte down, zero past the end,
+                                // then min(length - depth, 8) in the low byte so a shorter title sorts first.
+};
+
+// Load the characters of a key at a given depth into its cache.
+void loadTitleCache(TitleKey& key, std::size_t depth)
+{
+    std::uint64_t cache = 0;
+    std::size_t remaining = depth < key.length ? key.length - depth : 0;
+    for (std::size_t i = 0; i < TITLE_SORT_CACHED_CHARS; i++)
+    {
+        cache = (cache << 8) | (i < remaining ? static_cast<unsigned char>(key.characters[depth + i]) : 0);
+    }
+    key.cache = (cache << 8) | (remaining > TITLE_SORT_CACHED_CHARS ? TITLE_SORT_CACHED_CHARS + 1 : remaining);
+}
+
+// Check if a cache holds the end of its title, so equal caches mean equal titles.
+bool titleCacheIsLast(std::uint64_t cache)
+{
+    return (cache & 0xFF) <= TITLE_SORT_CACHED_CHARS;
+}
+
+// Check if one title sorts before another, given that both share their first depth characters
+// and their caches are loaded at depth.
+bool titleKeyLess(const TitleKey& first, const TitleKey& second, std::size_t depth)
+{
+    if (first.cache != second.cache || titleCacheIsLast(first.cache))
+    {
+        return first.cache < second.cache;
+    }
+
+    std::size_t rest = depth + TITLE_SORT_CACHED_CHARS;
+    return std::string_view(first.characters + rest, first.length - rest) < std::string_view(second.characters + rest, second.length - rest);
+}
+
+// Insertion sort for a small range of keys whose titles are known to share their first depth characters.
+// Parameters:
+//   - keys: The titles being sorted, with their caches loaded at depth.
+//   - low, high: The range of keys to sort, high excluded.
+//   - depth: The number of leading characters all titles in the range share.
+void titleInsertionSort(std::vector<TitleKey>& keys, int low, int high, std::size_t depth)
+{
+    for (int i = low + 1; i < high; i++)
+    {
+        TitleKey moving = keys[i];
+        int j = i;
+        while (j > low && titleKeyLess(moving, keys[j - 1], depth))
+        {
+            keys[j] = keys[j - 1];
+            j--;
+        }
+        keys[j] = moving;
+    }
+}
+
+// Multikey quicksort of a range of keys by title.
+// Parameters:
+//   - keys: The titles being sorted, with their caches loaded at depth.
+//   - low, high: The range of keys to sort, high excluded.
+//   - depth: The number of leading characters all titles in the range share.
+void multikeyQuickSort(std::vector<TitleKey>& keys, int low, int high, std::size_t depth)
+{
+    // The equal partition moves seven characters deeper in this loop instead of recursing,
+    // so long shared prefixes do not grow the stack.
+    while (high - low > TITLE_SORT_INSERTION_CUTOFF)
+    {
+        std::uint64_t pivot = keys[low + (high - low) / 2].cache;
+
+        // Three-way partition on the cache: [low, less) < pivot, [less, greater) == pivot, [greater, high) > pivot.
+        int less = low;
+        int greater = high;
+        int i = low;
+        while (i < greater)
+        {
+            std::uint64_t cache = keys[i].cache;
+            if (cache < pivot)
+            {
+                std::swap(keys[less++], keys[i++]);
+            }
+            else if (cache > pivot)
+            {
+                std::swap(keys[i], keys[--greater]);
+            }
+            else
+            {
+                i++;
+            }
+        }
+
+        multikeyQuickSort(keys, low, less, depth);
+        multikeyQuickSort(keys, greater, high, depth);
+
+        // Titles that ended within the cache are all equal, nothing is left to sort.
+        if (titleCacheIsLast(pivot))
+        {
+            return;
+        }
+        low = less;
+        high = greater;
+        depth += TITLE_SORT_CACHED_CHARS;
+        for (int k = low; k < high; k++)
+        {
+            loadTitleCache(keys[k], depth);
+        }
+    }
+
+    titleInsertionSort(keys, low, high, depth);
+}
+
+// Sorts a playlist by song titles in alphabetical order with multikey quicksort.
+// Parameters:
+//   - playlist: The playlist need to be sorted.
+template <class Playlist>
+void titleSort(Playlist& playlist)
+{
+    typedef typename Playlist::Position Position;
+
+    // The keys point into the playlist, which is not touched until the keys are sorted.
+    // While walking the playlist in order, also measure the prefix that every title shares,
+    // so the sort can start past it instead of partitioning on it one cache at a time.
+    std::vector<Position> positions;
+    std::vector<TitleKey> keys;
+    positions.reserve(playlist.getSize());
+    keys.reserve(playlist.getSize());
+    std::string_view shared;
+    for (Position current = playlist.getHead(); current != Position(); current = playlist.next(current))
+    {
+        std::string_view title = playlist.getTitle(current);
+        TitleKey key = { title.data(), static_cast<std::uint32_t>(title.size()), static_cast<std::int32_t>(keys.size()), 0 };
+        keys.push_back(key);
+        positions.push_back(current);
+
+        if (keys.size() == 1)
+        {
+            shared = title;
+        }
+        std::size_t common = 0;
+        while (common < shared.size() && common < title.size() && shared[common] == title[common])
+        {
+            common++;
+        }
+        shared = shared.substr(0, common);
+    }
+
+    for (std::size_t i = 0; i < keys.size(); i++)
+    {
+        loadTitleCache(keys[i], shared.size());
+    }
+    multikeyQuickSort(keys, 0, static_cast<int>(keys.size()), shared.size());
+
+    // The song keys[i].song belongs at position i. Reuse the keys' order to link the songs that way.
+    std::vector<Position> order;
+    order.reserve(keys.size());
+    for (std::size_t i = 0; i < keys.size(); i++)
+    {
+        order.push_back(positions[keys[i].song]);
+    }
+    playlist.relink(order);
+}
+
+#endif
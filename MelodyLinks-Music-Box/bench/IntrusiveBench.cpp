@@ -0,0 +1,222 @@
+#include "../DoublyLinkedList.h"
+#include "../IntrusivePlaylist.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+/*
+    Author: Ky Lam
+    Date: October 18, 2026
+    Description: Compares the intrusive mode against the Node<Song> wrapper of DoublyLinkedList on
+    insert and remove throughput and on memory. Three lists hold the same songs:
+        node        DoublyLinkedList<Song>, one heap node with a copy of the Song per push_back.
+        arena       IntrusivePlaylist, copies into a block arena and recycles the slots of removed songs.
+        library     IntrusiveList<LinkedSong> linking songs that already live in a std::vector, no copies at all.
+    Every list gets all songs appended, then removed one by one in random order through erase(position),
+    then appended again. Memory is the number and bytes of heap allocations made while filling the list
+    the first time, counted by replacing the global operator new; the allocator adds its own header to each.
+    Every list runs in a process of its own, so one does not inherit the heap the previous one left behind.
+    Usage: IntrusiveBench [songs] [node|arena|library]      (defaults: 1000000 songs, every list)
+    Build: g++ -std=c++17 -O2 -I.. IntrusiveBench.cpp -o IntrusiveBench
+*/
+
+std::size_t allocationCount = 0;    // Heap allocations since the last reset.
+std::size_t allocationBytes = 0;    // Bytes requested by those allocations.
+
+// Allocates and counts the memory behind every replaced operator new.
+// It stays out of line, like releaseAllocation, so the optimizer never sees malloc() on one side of a
+// new and delete pair and the replaced operator delete on the other, which GCC reports as mismatched.
+[[gnu::noinline]] void* countAllocation(std::size_t size)
+{
+    allocationCount++;
+    allocationBytes += size;
+    void* memory = std::malloc(size);
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+// Frees the memory of countAllocation behind every replaced operator delete.
+[[gnu::noinline]] void releaseAllocation(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void* operator new(std::size_t size)
+{
+    return countAllocation(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return countAllocation(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    releaseAllocation(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    releaseAllocation(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    releaseAllocation(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    releaseAllocation(memory);
+}
+
+// Milliseconds elapsed since a point in time.
+double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Prints one row of results.
+void printRow(const char* name, double insertTime, double removeTime, double reinsertTime, std::size_t allocations, std::size_t bytes, int songCount)
+{
+    std::cout << std::left << std::setw(10) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << insertTime << std::setw(12) << removeTime << std::setw(12) << reinsertTime
+              << std::setw(14) << allocations << std::setw(14) << std::setprecision(1) << static_cast<double>(bytes) / songCount << std::endl;
+}
+
+// Appends, removes in the given order and appends again on a playlist container.
+template <class Playlist>
+void runPlaylist(const char* name, const std::vector<Song>& songs, const std::vector<int>& removeOrder)
+{
+    typedef typename Playlist::Position Position;
+    Playlist playlist;
+
+    allocationCount = allocationBytes = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < songs.size(); i++)
+    {
+        playlist.push_back(songs[i]);
+    }
+    double insertTime = millisecondsSince(start);
+    std::size_t allocations = allocationCount;
+    std::size_t bytes = allocationBytes;
+
+    std::vector<Position> positions;
+    positions.reserve(songs.size());
+    for (Position current = playlist.getHead(); current != Position(); current = playlist.next(current))
+    {
+        positions.push_back(current);
+    }
+
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < removeOrder.size(); i++)
+    {
+        playlist.erase(positions[removeOrder[i]]);
+    }
+    double removeTime = millisecondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < songs.size(); i++)
+    {
+        playlist.push_back(songs[i]);
+    }
+    double reinsertTime = millisecondsSince(start);
+
+    printRow(name, insertTime, removeTime, reinsertTime, allocations, bytes, static_cast<int>(songs.size()));
+}
+
+// Links songs that already live in a library vector, without copying them.
+void runLibrary(const std::vector<Song>& songs, const std::vector<int>& removeOrder)
+{
+    std::vector<LinkedSong> library(songs.begin(), songs.end());
+    IntrusiveList<LinkedSong> playlist;
+
+    allocationCount = allocationBytes = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < library.size(); i++)
+    {
+        playlist.push_back(library[i]);
+    }
+    double insertTime = millisecondsSince(start);
+    std::size_t allocations = allocationCount;
+    std::size_t bytes = allocationBytes;
+
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < removeOrder.size(); i++)
+    {
+        playlist.erase(library[removeOrder[i]]);
+    }
+    double removeTime = millisecondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < library.size(); i++)
+    {
+        playlist.push_back(library[i]);
+    }
+    double reinsertTime = millisecondsSince(start);
+
+    printRow("library", insertTime, removeTime, reinsertTime, allocations, bytes, static_cast<int>(songs.size()));
+}
+
+int main(int argc, char* argv[])
+{
+    int songCount = argc > 1 ? std::atoi(argv[1]) : 1000000;
+
+    std::mt19937 random(3);
+    std::vector<Song> songs;
+    songs.reserve(songCount);
+    for (int i = 0; i < songCount; i++)
+    {
+        songs.push_back(Song("Track " + std::to_string(random()), 60 + i % 240));
+    }
+
+    std::vector<int> removeOrder(songCount);
+    for (int i = 0; i < songCount; i++)
+    {
+        removeOrder[i] = i;
+    }
+    std::shuffle(removeOrder.begin(), removeOrder.end(), random);
+
+    if (argc > 2)
+    {
+        if (std::strcmp(argv[2], "node") == 0)
+        {
+            runPlaylist<DoublyLinkedList<Song>>("node", songs, removeOrder);
+        }
+        else if (std::strcmp(argv[2], "arena") == 0)
+        {
+            runPlaylist<IntrusivePlaylist>("arena", songs, removeOrder);
+        }
+        else
+        {
+            runLibrary(songs, removeOrder);
+        }
+        return 0;
+    }
+
+    std::cout << songCount << " songs (times in ms, memory of the first fill)" << std::endl;
+    std::cout << std::left << std::setw(10) << "list" << std::right << std::setw(12) << "insert" << std::setw(12) << "remove"
+              << std::setw(12) << "reinsert" << std::setw(14) << "allocations" << std::setw(14) << "bytes/song" << std::endl;
+    const char* lists[] = { "node", "arena", "library" };
+    for (int i = 0; i < 3; i++)
+    {
+        std::string command = std::string("\"") + argv[0] + "\" " + std::to_string(songCount) + " " + lists[i];
+        if (std::system(command.c_str()) != 0)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
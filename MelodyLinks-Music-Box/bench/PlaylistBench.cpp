@@ -0,0 +1,102 @@
+#include "../MusicBox.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+/*
+    Author: Ky Lam
+    Date: October 18, 2026
+    Description: Compares the three playlist containers behind MusicBox on the same workload:
+    building the playlist, full scans (a search for a missing title and a display of every song),
+    sorting by title with QUICK_SORT, and removing random titles one at a time.
+    Usage: PlaylistBench [songs] [removals]     (defaults: 200000 songs, 1000 removals)
+    Build: g++ -std=c++17 -O2 -I.. PlaylistBench.cpp -o PlaylistBench
+*/
+
+const int SCAN_ROUNDS = 20;     // Full scans timed per container.
+
+// Milliseconds elapsed since a point in time.
+double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Runs the workload on one container and prints a row of timings.
+// Parameters:
+//   - name: The name of the container in the table.
+//   - titles: The titles to add, in order.
+//   - removeTitles: The titles to remove after sorting.
+template <class Playlist>
+void runBench(const char* name, const std::vector<std::string>& titles, const std::vector<std::string>& removeTitles)
+{
+    std::ostream sink(nullptr);     // Discards every MusicBox message.
+    BasicMusicBox<Playlist> musicBox;
+    musicBox.setOutput(sink);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < titles.size(); i++)
+    {
+        musicBox.addSong(titles[i], 60 + static_cast<int>(i % 240));
+    }
+    double buildTime = millisecondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int round = 0; round < SCAN_ROUNDS; round++)
+    {
+        musicBox.searchSong("not in the playlist");
+    }
+    double searchTime = millisecondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    musicBox.displayPlaylist();
+    double displayTime = millisecondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    musicBox.sort(QUICK_SORT);
+    double sortTime = millisecondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < removeTitles.size(); i++)
+    {
+        musicBox.removeSong(removeTitles[i], false);
+    }
+    double removeTime = millisecondsSince(start);
+
+    std::cout << std::left << std::setw(12) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << buildTime << std::setw(12) << searchTime << std::setw(10) << displayTime
+              << std::setw(10) << sortTime << std::setw(10) << removeTime << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    int songCount = argc > 1 ? std::atoi(argv[1]) : 200000;
+    int removeCount = argc > 2 ? std::atoi(argv[2]) : 1000;
+
+    std::mt19937 random(42);
+    std::vector<std::string> titles;
+    titles.reserve(songCount);
+    for (int i = 0; i < songCount; i++)
+    {
+        titles.push_back("Track " + std::to_string(random()) + " " + std::to_string(i));
+    }
+
+    std::vector<std::string> removeTitles;
+    for (int i = 0; i < removeCount && songCount > 0; i++)
+    {
+        removeTitles.push_back(titles[random() % songCount]);
+    }
+
+    std::cout << songCount << " songs, " << SCAN_ROUNDS << " searches, " << removeCount << " removals (ms)" << std::endl;
+    std::cout << std::left << std::setw(12) << "container" << std::right << std::setw(10) << "build" << std::setw(12) << "20 searches"
+              << std::setw(10) << "display" << std::setw(10) << "sort" << std::setw(10) << "remove" << std::endl;
+    runBench<DoublyLinkedList<Song>>("linked", titles, removeTitles);
+    runBench<ContiguousPlaylist>("contiguous", titles, removeTitles);
+    runBench<IntrusivePlaylist>("intrusive", titles, removeTitles);
+    return 0;
+}
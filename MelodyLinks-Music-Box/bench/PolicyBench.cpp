@@ -0,0 +1,134 @@
+#include "../DoublyLinkedList.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/*
+    Author: Ky Lam
+    Date: October 18, 2026
+    Description: Measures the cost per operation of the four DoublyLinkedList policy configurations
+        tracked/checked     TrackedSize, CheckedAccess (the default)
+        tracked/unchecked   TrackedSize, UncheckedAccess
+        untracked/checked   UntrackedSize, CheckedAccess
+        untracked/unchecked UntrackedSize, UncheckedAccess
+    on a list of ints, so the node bookkeeping is not hidden behind copying songs:
+        push_back   appending every item to an empty list.
+        getSize     one call on the full list.
+        at          one call at a random position, walking to it.
+        scan        contains() of a missing item, per node visited.
+        erase       removing the head until the list is empty, per item.
+    Every configuration runs in a process of its own, so none walks nodes the previous one scattered over the heap.
+    Building with -DPOLICY_BENCH_CONFIG=0..3 compiles only the configuration of that row, in the order above,
+    so the size of the binaries compares the code each configuration generates; PolicyCodeSize.sh does that.
+    Usage: PolicyBench [items] [configuration]      (defaults: 100000 items, every configuration)
+    Build: g++ -std=c++17 -O2 -I.. PolicyBench.cpp -o PolicyBench
+*/
+
+typedef std::chrono::steady_clock Clock;
+
+const int GET_SIZE_CALLS = 200;     // getSize() calls timed per configuration.
+const int AT_CALLS = 2000;          // at() calls timed per configuration.
+
+long long checksum = 0;             // Folds in every result so the optimizer keeps the work.
+
+// Nanoseconds per operation since a point in time.
+double nanosecondsPer(Clock::time_point start, long long operations)
+{
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / operations;
+}
+
+// Times every operation on one configuration and prints a row of results.
+template <class SizePolicy, class AccessPolicy>
+void runPolicy(const char* name, int items)
+{
+    DoublyLinkedList<int, SizePolicy, AccessPolicy> list;
+
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < items; i++)
+    {
+        list.push_back(i);
+    }
+    double pushTime = nanosecondsPer(start, items);
+
+    start = Clock::now();
+    for (int i = 0; i < GET_SIZE_CALLS; i++)
+    {
+        checksum += list.getSize();
+    }
+    double sizeTime = nanosecondsPer(start, GET_SIZE_CALLS);
+
+    unsigned int position = 12345;
+    start = Clock::now();
+    for (int i = 0; i < AT_CALLS; i++)
+    {
+        position = position * 1103515245 + 12345;
+        checksum += list.at(1 + static_cast<int>(position % items));
+    }
+    double atTime = nanosecondsPer(start, AT_CALLS);
+
+    start = Clock::now();
+    checksum += list.contains(-1);
+    double scanTime = nanosecondsPer(start, items);
+
+    start = Clock::now();
+    while (list.getHead() != nullptr)
+    {
+        list.erase(list.getHead());
+    }
+    double eraseTime = nanosecondsPer(start, items);
+
+    std::cout << std::left << std::setw(22) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(12) << pushTime << std::setw(14) << sizeTime << std::setw(14) << atTime
+              << std::setw(10) << scanTime << std::setw(10) << eraseTime << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    int items = argc > 1 ? std::atoi(argv[1]) : 100000;
+
+    if (argc > 2)
+    {
+        int configuration = std::atoi(argv[2]);
+#if !defined(POLICY_BENCH_CONFIG) || POLICY_BENCH_CONFIG == 0
+        if (configuration == 0)
+        {
+            runPolicy<TrackedSize, CheckedAccess>("tracked/checked", items);
+        }
+#endif
+#if !defined(POLICY_BENCH_CONFIG) || POLICY_BENCH_CONFIG == 1
+        if (configuration == 1)
+        {
+            runPolicy<TrackedSize, UncheckedAccess>("tracked/unchecked", items);
+        }
+#endif
+#if !defined(POLICY_BENCH_CONFIG) || POLICY_BENCH_CONFIG == 2
+        if (configuration == 2)
+        {
+            runPolicy<UntrackedSize, CheckedAccess>("untracked/checked", items);
+        }
+#endif
+#if !defined(POLICY_BENCH_CONFIG) || POLICY_BENCH_CONFIG == 3
+        if (configuration == 3)
+        {
+            runPolicy<UntrackedSize, UncheckedAccess>("untracked/unchecked", items);
+        }
+#endif
+        return 0;
+    }
+
+    std::cout << items << " ints (ns per operation)" << std::endl;
+    std::cout << std::left << std::setw(22) << "configuration" << std::right << std::setw(12) << "push_back"
+              << std::setw(14) << "getSize" << std::setw(14) << "at" << std::setw(10) << "scan" << std::setw(10) << "erase" << std::endl;
+    for (int configuration = 0; configuration < 4; configuration++)
+    {
+        std::string command = std::string("\"") + argv[0] + "\" " + std::to_string(items) + " " + std::to_string(configuration);
+        if (std::system(command.c_str()) != 0)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
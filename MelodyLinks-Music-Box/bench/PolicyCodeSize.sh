@@ -0,0 +1,22 @@
+#!/bin/sh
+# Author: Ky Lam
+# Date: October 18, 2026
+# Description: Builds PolicyBench once per DoublyLinkedList policy configuration and prints the size of the
+# code each one generates: the text segment of the whole binary, and the bytes of the DoublyLinkedList
+# functions the compiler kept out of line (the rest are inlined into the benchmark and counted in text).
+# Usage: sh PolicyCodeSize.sh [compiler flags]     (default: -O2), run from the bench directory.
+
+FLAGS=${*:--O2}
+NAMES="tracked/checked tracked/unchecked untracked/checked untracked/unchecked"
+CONFIG=0
+printf '%-22s %10s %16s\n' configuration text list-functions
+for NAME in $NAMES
+do
+    BINARY=${TMPDIR:-/tmp}/PolicyBench$CONFIG
+    ${CXX:-g++} -std=c++17 $FLAGS -I.. -DPOLICY_BENCH_CONFIG=$CONFIG PolicyBench.cpp -o "$BINARY" || exit 1
+    TEXT=$(size "$BINARY" | awk 'NR == 2 { print $1 }')
+    LIST=$(nm -C -S -t d "$BINARY" | grep 'DoublyLinkedList<int' | awk '{ total += $2 } END { print total + 0 }')
+    printf '%-22s %10s %16s\n' "$NAME" "$TEXT" "$LIST"
+    rm -f "$BINARY"
+    CONFIG=$((CONFIG + 1))
+done
@@ -0,0 +1,135 @@
+#include "../MusicBoxScheduler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/*
+    Author: Ky Lam
+    Date: October 18, 2026
+    Description: A local load generator for MusicBoxScheduler. Client threads submit a mix of commands
+    (60% searches, 20% adds, 10% removes, 10% next song) to one MusicBox through its scheduler,
+    keeping up to a window of commands in flight each, and measure the latency of every command
+    from submit() until its future is ready.
+    It reports throughput and latency percentiles for the linked, contiguous and intrusive music boxes.
+    Usage: SchedulerLoad [clients] [commands per client] [window] [songs]     (defaults: 8 20000 16 1000)
+    Build: g++ -std=c++17 -O2 -pthread -I.. SchedulerLoad.cpp -o SchedulerLoad
+*/
+
+typedef std::chrono::steady_clock Clock;
+
+// Submits commands from one client and records the latency of every one in microseconds.
+// Parameters:
+//   - scheduler: The scheduler to drive.
+//   - client: The number of the client, used to seed its command mix.
+//   - commands: How many commands to submit.
+//   - window: How many commands may be in flight at once.
+//   - songs: The number of songs the playlist started with, to pick existing titles.
+//   - latencies: Receives one latency per command.
+template <class Playlist>
+void runClient(BasicMusicBoxScheduler<Playlist>& scheduler, int client, int commands, int window, int songs, std::vector<double>& latencies)
+{
+    std::mt19937 random(client + 1);
+    std::deque<std::pair<std::future<bool>, Clock::time_point>> inFlight;
+    latencies.reserve(commands);
+
+    for (int i = 0; i < commands; i++)
+    {
+        std::string title = "Song " + std::to_string(random() % (songs * 2));
+        int kind = random() % 10;
+
+        Clock::time_point start = Clock::now();
+        std::future<bool> result;
+        if (kind < 6)
+        {
+            result = scheduler.searchSong(title);
+        }
+        else if (kind < 8)
+        {
+            result = scheduler.addSong(title, 60 + random() % 240);
+        }
+        else if (kind < 9)
+        {
+            result = scheduler.removeSong(title);
+        }
+        else
+        {
+            result = scheduler.submit([](typename BasicMusicBoxScheduler<Playlist>::Box& box) { box.playNext(); return true; });
+        }
+        inFlight.push_back(std::make_pair(std::move(result), start));
+
+        // Wait for the oldest commands once the window is full, and for all of them at the end.
+        while (!inFlight.empty() && (static_cast<int>(inFlight.size()) >= window || i == commands - 1))
+        {
+            inFlight.front().first.get();
+            latencies.push_back(std::chrono::duration<double, std::micro>(Clock::now() - inFlight.front().second).count());
+            inFlight.pop_front();
+        }
+    }
+}
+
+// Runs the load against one kind of MusicBox and prints a row of results.
+template <class Playlist>
+void runLoad(const char* name, int clients, int commands, int window, int songs)
+{
+    std::ostream sink(nullptr);     // Discards every MusicBox message.
+    BasicMusicBox<Playlist> musicBox;
+    musicBox.setOutput(sink);
+    for (int i = 0; i < songs; i++)
+    {
+        musicBox.addSong("Song " + std::to_string(i), 60 + i % 240);
+    }
+
+    std::vector<std::vector<double>> latencies(clients);
+    Clock::time_point start = Clock::now();
+    {
+        BasicMusicBoxScheduler<Playlist> scheduler(musicBox);
+        std::vector<std::thread> threads;
+        for (int c = 0; c < clients; c++)
+        {
+            threads.push_back(std::thread(runClient<Playlist>, std::ref(scheduler), c, commands, window, songs, std::ref(latencies[c])));
+        }
+        for (int c = 0; c < clients; c++)
+        {
+            threads[c].join();
+        }
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::vector<double> all;
+    for (int c = 0; c < clients; c++)
+    {
+        all.insert(all.end(), latencies[c].begin(), latencies[c].end());
+    }
+    std::sort(all.begin(), all.end());
+
+    std::cout << std::left << std::setw(12) << name << std::right << std::fixed << std::setprecision(0)
+              << std::setw(14) << all.size() / seconds << std::setprecision(1)
+              << std::setw(12) << all[all.size() / 2] << std::setw(12) << all[all.size() * 99 / 100]
+              << std::setw(12) << all.back() << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    int clients = argc > 1 ? std::atoi(argv[1]) : 8;
+    int commands = argc > 2 ? std::atoi(argv[2]) : 20000;
+    int window = argc > 3 ? std::atoi(argv[3]) : 16;
+    int songs = argc > 4 ? std::atoi(argv[4]) : 1000;
+
+    std::cout << clients << " clients x " << commands << " commands, window " << window << ", " << songs
+              << " songs, hardware threads " << std::thread::hardware_concurrency() << std::endl;
+    std::cout << std::left << std::setw(12) << "music box" << std::right << std::setw(14) << "commands/s"
+              << std::setw(12) << "p50 (us)" << std::setw(12) << "p99 (us)" << std::setw(12) << "max (us)" << std::endl;
+    runLoad<DoublyLinkedList<Song>>("linked", clients, commands, window, songs);
+    runLoad<ContiguousPlaylist>("contiguous", clients, commands, window, songs);
+    runLoad<IntrusivePlaylist>("intrusive", clients, commands, window, songs);
+    return 0;
+}
@@ -0,0 +1,270 @@
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/*
+    Author: Ky Lam
+    Date: October 18, 2026
+    Description: A client benchmark for "MelodyLinks --serve <path|port>". It first fills the playlist over
+    one connection, then opens one connection per client thread and sends a mix of requests
+    (60% SEARCH, 20% ADD, 10% REMOVE, 10% NEXT), pipelining up to a window of requests on each.
+    The latency of a request runs from sending it until its status line arrives: the first line of the response
+    that does not start with "- ", the prefix of every MusicBox message line.
+    It reports requests per second over all connections and latency percentiles. Linux only.
+    Usage: ServeClientBench <path|port> [connections] [requests per connection] [window] [songs]
+           (defaults: 8 20000 16 1000), with the server started first, for example
+           ./MelodyLinks --serve /tmp/melodylinks.sock & ./ServeClientBench /tmp/melodylinks.sock
+    Build: g++ -std=c++17 -O2 -pthread ServeClientBench.cpp -o ServeClientBench
+*/
+
+typedef std::chrono::steady_clock Clock;
+
+// Connects to the server.
+// Returns: The socket, or -1 if the server cannot be reached.
+int connectToServer(const std::string& address)
+{
+    bool isPort = !address.empty() && address.find_first_not_of("0123456789") == std::string::npos;
+    int server = socket(isPort ? AF_INET : AF_UNIX, SOCK_STREAM, 0);
+    int connected;
+    if (isPort)
+    {
+        sockaddr_in remote;
+        std::memset(&remote, 0, sizeof(remote));
+        remote.sin_family = AF_INET;
+        remote.sin_port = htons(static_cast<unsigned short>(std::atoi(address.c_str())));
+        remote.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        connected = connect(server, reinterpret_cast<sockaddr*>(&remote), sizeof(remote));
+        int noDelay = 1;
+        setsockopt(server, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+    }
+    else
+    {
+        sockaddr_un remote;
+        std::memset(&remote, 0, sizeof(remote));
+        remote.sun_family = AF_UNIX;
+        std::strncpy(remote.sun_path, address.c_str(), sizeof(remote.sun_path) - 1);
+        connected = connect(server, reinterpret_cast<sockaddr*>(&remote), sizeof(remote));
+    }
+
+    if (connected < 0)
+    {
+        std::cerr << "connect to " << address << ": " << std::strerror(errno) << std::endl;
+        close(server);
+        return -1;
+    }
+    return server;
+}
+
+// Sends a whole buffer.
+// Returns: False if the connection failed.
+bool sendAll(int server, const std::string& data)
+{
+    std::size_t written = 0;
+    while (written < data.size())
+    {
+        ssize_t sent = send(server, data.data() + written, data.size() - written, MSG_NOSIGNAL);
+        if (sent <= 0)
+        {
+            return false;
+        }
+        written += sent;
+    }
+    return true;
+}
+
+// Reads from the server until at least one more status line arrived.
+// Message lines start with "- " and are skipped, every other line is the status line of one request.
+// Parameters:
+//   - server: The socket.
+//   - pending: Bytes received but not yet split into lines.
+//   - errors: Counts the status lines other than "OK".
+// Returns: The number of status lines read, or -1 if the connection closed.
+int readStatusLines(int server, std::string& pending, long long& errors)
+{
+    int statuses = 0;
+    char buffer[65536];
+    while (statuses == 0)
+    {
+        ssize_t received = recv(server, buffer, sizeof(buffer), 0);
+        if (received <= 0)
+        {
+            return -1;
+        }
+        pending.append(buffer, received);
+
+        std::size_t lineStart = 0;
+        std::size_t lineEnd;
+        while ((lineEnd = pending.find('\n', lineStart)) != std::string::npos)
+        {
+            if (pending.compare(lineStart, 2, "- ") != 0)
+            {
+                statuses++;
+                if (pending.compare(lineStart, lineEnd - lineStart, "OK") != 0)
+                {
+                    errors++;
+                }
+            }
+            lineStart = lineEnd + 1;
+        }
+        pending.erase(0, lineStart);
+    }
+    return statuses;
+}
+
+// Sends requests over one connection and records the latency of every one in microseconds.
+// Parameters:
+//   - address: The address of the server.
+//   - client: The number of the client, used to seed its request mix.
+//   - requests: How many requests to send.
+//   - window: How many requests may be in flight at once.
+//   - songs: The number of songs the playlist started with, to pick existing titles.
+//   - latencies: Receives one latency per request.
+//   - errors: Counts the requests answered with "ERR".
+void runClient(const std::string& address, int client, int requests, int window, int songs, std::vector<double>& latencies, long long& errors)
+{
+    int server = connectToServer(address);
+    if (server < 0)
+    {
+        return;
+    }
+
+    std::mt19937 random(client + 1);
+    std::deque<Clock::time_point> inFlight;
+    std::string pending;
+    latencies.reserve(requests);
+
+    int sent = 0;
+    while (sent < requests || !inFlight.empty())
+    {
+        // Top the window up with one write, then wait for at least one answer.
+        std::string batch;
+        Clock::time_point now = Clock::now();
+        while (sent < requests && static_cast<int>(inFlight.size()) < window)
+        {
+            std::string title = "Song " + std::to_string(random() % (songs * 2));
+            int kind = random() % 10;
+            if (kind < 6)
+            {
+                batch += "SEARCH " + title + "\n";
+            }
+            else if (kind < 8)
+            {
+                batch += "ADD " + std::to_string(60 + random() % 240) + " " + title + "\n";
+            }
+            else if (kind < 9)
+            {
+                batch += "REMOVE " + title + "\n";
+            }
+            else
+            {
+                batch += "NEXT\n";
+            }
+            inFlight.push_back(now);
+            sent++;
+        }
+        if (!batch.empty() && !sendAll(server, batch))
+        {
+            break;
+        }
+
+        int answered = readStatusLines(server, pending, errors);
+        if (answered < 0)
+        {
+            break;
+        }
+        now = Clock::now();
+        for (int i = 0; i < answered && !inFlight.empty(); i++)
+        {
+            latencies.push_back(std::chrono::duration<double, std::micro>(now - inFlight.front()).count());
+            inFlight.pop_front();
+        }
+    }
+
+    sendAll(server, "QUIT\n");
+    close(server);
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: ServeClientBench <path|port> [connections] [requests per connection] [window] [songs]" << std::endl;
+        return 1;
+    }
+    std::string address = argv[1];
+    int connections = argc > 2 ? std::atoi(argv[2]) : 8;
+    int requests = argc > 3 ? std::atoi(argv[3]) : 20000;
+    int window = argc > 4 ? std::atoi(argv[4]) : 16;
+    int songs = argc > 5 ? std::atoi(argv[5]) : 1000;
+
+    // Fill the playlist over one connection, in a single pipelined batch.
+    int server = connectToServer(address);
+    if (server < 0)
+    {
+        return 1;
+    }
+    std::string fill;
+    for (int i = 0; i < songs; i++)
+    {
+        fill += "ADD " + std::to_string(60 + i % 240) + " Song " + std::to_string(i) + "\n";
+    }
+    fill += "QUIT\n";
+    sendAll(server, fill);
+    char drain[65536];
+    while (recv(server, drain, sizeof(drain), 0) > 0)
+    {
+    }
+    close(server);
+
+    std::vector<std::vector<double>> latencies(connections);
+    std::vector<long long> errors(connections, 0);
+    Clock::time_point start = Clock::now();
+    std::vector<std::thread> threads;
+    for (int c = 0; c < connections; c++)
+    {
+        threads.push_back(std::thread(runClient, address, c, requests, window, songs, std::ref(latencies[c]), std::ref(errors[c])));
+    }
+    for (int c = 0; c < connections; c++)
+    {
+        threads[c].join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::vector<double> all;
+    long long errorCount = 0;
+    for (int c = 0; c < connections; c++)
+    {
+        all.insert(all.end(), latencies[c].begin(), latencies[c].end());
+        errorCount += errors[c];
+    }
+    if (all.empty())
+    {
+        std::cerr << "no request was answered" << std::endl;
+        return 1;
+    }
+    std::sort(all.begin(), all.end());
+
+    std::cout << connections << " connections x " << requests << " requests, window " << window << ", " << songs << " songs" << std::endl;
+    std::cout << std::right << std::setw(12) << "requests" << std::setw(14) << "requests/s" << std::setw(12) << "p50 (us)"
+              << std::setw(12) << "p99 (us)" << std::setw(12) << "max (us)" << std::setw(10) << "ERR" << std::endl;
+    std::cout << std::fixed << std::setw(12) << all.size() << std::setprecision(0) << std::setw(14) << all.size() / seconds
+              << std::setprecision(1) << std::setw(12) << all[all.size() / 2] << std::setw(12) << all[all.size() * 99 / 100]
+              << std::setw(12) << all.back() << std::setw(10) << errorCount << std::endl;
+    return 0;
+}
@@ -0,0 +1,120 @@
+#include "../ContiguousPlaylist.h"
+#include "../DoublyLinkedList.h"
+#include "../PlaybackTimeline.h"
+#include "../Song.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+    Author: Ky Lam
+    Date: October 18, 2026
+    Description: Measures how many listener sessions per second one shared PlaybackTimeline can advance.
+    Every listener is a PlaybackCursor, a song index and the seconds played of it, over the same playlist.
+    Each round moves every listener forward by a random 1 to 600 seconds, in two ways:
+        advance     PlaybackTimeline::advance, which only counts the track changes (two binary searches).
+        simulate    PlaybackTimeline::simulate, which also reports the title and duration of every song
+                    started along the way, read from the playlist without building a Song.
+    Both run over the linked and the contiguous playlists, and must agree on the number of track changes.
+    Usage: SessionBench [listeners] [songs] [rounds]     (defaults: 1000000 10000 5)
+    Build: g++ -std=c++17 -O2 -I.. SessionBench.cpp -o SessionBench
+*/
+
+long long titleBytes = 0;           // Folds in every reported song so the optimizer keeps the callbacks.
+
+// Advances every listener for a number of rounds and prints a row of results.
+// Parameters:
+//   - name: The name of the container in the table.
+//   - titles: The titles of the playlist, in order.
+//   - listeners: The number of listener sessions.
+//   - rounds: How many times every listener is advanced.
+template <class Playlist>
+void runSessions(const char* name, const std::vector<std::string>& titles, int listeners, int rounds)
+{
+    Playlist playlist;
+    for (std::size_t i = 0; i < titles.size(); i++)
+    {
+        playlist.push_back(Song(titles[i], 60 + static_cast<int>(i % 240)));
+    }
+    PlaybackTimeline<Playlist> timeline;
+    timeline.rebuild(playlist);
+
+    std::mt19937 random(11);
+    std::vector<PlaybackCursor> cursors(listeners);
+    std::vector<int> steps(static_cast<std::size_t>(listeners) * rounds);
+    for (int i = 0; i < listeners; i++)
+    {
+        cursors[i].index = static_cast<int>(random() % titles.size());
+        cursors[i].elapsed = 0;
+    }
+    for (std::size_t i = 0; i < steps.size(); i++)
+    {
+        steps[i] = 1 + random() % 600;
+    }
+    std::vector<PlaybackCursor> simulated = cursors;
+
+    long long advanceChanges = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++)
+    {
+        for (int i = 0; i < listeners; i++)
+        {
+            advanceChanges += timeline.advance(cursors[i], steps[static_cast<std::size_t>(round) * listeners + i]);
+        }
+    }
+    double advanceTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    long long simulateChanges = 0;
+    start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++)
+    {
+        for (int i = 0; i < listeners; i++)
+        {
+            simulateChanges += timeline.simulate(playlist, simulated[i], steps[static_cast<std::size_t>(round) * listeners + i],
+                [](std::string_view title, int duration, long long) { titleBytes += title.size() + duration; });
+        }
+    }
+    double simulateTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    bool agree = advanceChanges == simulateChanges;
+    for (int i = 0; i < listeners && agree; i++)
+    {
+        agree = cursors[i].index == simulated[i].index && cursors[i].elapsed == simulated[i].elapsed;
+    }
+
+    double sessions = static_cast<double>(listeners) * rounds;
+    std::cout << std::left << std::setw(12) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(16) << sessions / advanceTime / 1e6 << std::setw(16) << sessions / simulateTime / 1e6
+              << std::setw(16) << advanceChanges << (agree ? "" : "  MISMATCH") << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    int listeners = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    int songCount = argc > 2 ? std::atoi(argv[2]) : 10000;
+    int rounds = argc > 3 ? std::atoi(argv[3]) : 5;
+    if (listeners <= 0 || songCount <= 0 || rounds <= 0)
+    {
+        std::cerr << "Usage: SessionBench [listeners] [songs] [rounds]" << std::endl;
+        return 1;
+    }
+
+    std::vector<std::string> titles;
+    for (int i = 0; i < songCount; i++)
+    {
+        titles.push_back("Track " + std::to_string(i));
+    }
+
+    std::cout << listeners << " listeners, " << songCount << " songs, " << rounds << " rounds (millions of sessions advanced per second)" << std::endl;
+    std::cout << std::left << std::setw(12) << "container" << std::right << std::setw(16) << "advance"
+              << std::setw(16) << "simulate" << std::setw(16) << "track changes" << std::endl;
+    runSessions<DoublyLinkedList<Song>>("linked", titles, listeners, rounds);
+    runSessions<ContiguousPlaylist>("contiguous", titles, listeners, rounds);
+    return 0;
+}
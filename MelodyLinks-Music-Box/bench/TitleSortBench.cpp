@@ -0,0 +1,146 @@
+#include "../MusicBox.h"
+
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*
+    Author: Ky Lam
+    Date: October 18, 2026
+    Description: Compares MusicBox::sort with QUICK_SORT and TITLE_RADIX_SORT on title distributions
+    seen in real catalogs, for the linked and the contiguous playlists:
+        catalog     every title is "The Complete Recordings: Symphony No. N", so all share a 38-character prefix.
+        mixed       a handful of common prefixes ("The ", "Live at ", "Symphony No. ", ...) followed by a random word and number.
+        random      short random titles with hardly any shared prefix.
+    Both sorts get the same shuffled playlist, and the sorted playlists are checked to be equal.
+    Usage: TitleSortBench [songs...]        (defaults: 100000 1000000; 10000000 needs several GB of memory)
+    Build: g++ -std=c++17 -O2 -I.. TitleSortBench.cpp -o TitleSortBench
+*/
+
+// Makes songCount titles of a distribution, in random order.
+std::vector<std::string> makeTitles(const std::string& distribution, int songCount)
+{
+    static const char* prefixes[] = { "The ", "Live at ", "Symphony No. ", "The Best of ", "Concerto for ", "" };
+    static const char* words[] = { "Moon", "River", "Night", "Blue", "Golden", "Heart", "Road", "Fire" };
+
+    std::mt19937 random(7);
+    std::vector<std::string> titles;
+    titles.reserve(songCount);
+    for (int i = 0; i < songCount; i++)
+    {
+        if (distribution == "catalog")
+        {
+            titles.push_back("The Complete Recordings: Symphony No. " + std::to_string(random() % (songCount * 4 + 1)));
+        }
+        else if (distribution == "mixed")
+        {
+            titles.push_back(std::string(prefixes[random() % 6]) + words[random() % 8] + " " + std::to_string(random() % 100000));
+        }
+        else
+        {
+            std::string title;
+            for (int length = 6 + random() % 10; length > 0; length--)
+            {
+                title += static_cast<char>('a' + random() % 26);
+            }
+            titles.push_back(title);
+        }
+    }
+    return titles;
+}
+
+// Fills a music box with the titles, in order.
+template <class Playlist>
+void fillMusicBox(BasicMusicBox<Playlist>& musicBox, std::ostream& sink, const std::vector<std::string>& titles)
+{
+    musicBox.setOutput(sink);
+    for (std::size_t i = 0; i < titles.size(); i++)
+    {
+        musicBox.addSong(titles[i], 180);
+    }
+}
+
+// Times one sort of a music box.
+// Parameters:
+//   - musicBox: The music box to sort.
+//   - method: The sort to time.
+//   - sorted: Receives the playlist after sorting.
+// Returns: The sort time in milliseconds.
+template <class Playlist>
+double timeSort(BasicMusicBox<Playlist>& musicBox, SortMethod method, std::ostringstream& sorted)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    musicBox.sort(method);
+    double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    musicBox.setOutput(sorted);
+    musicBox.displayPlaylist();
+    return elapsed;
+}
+
+// Prints one row comparing both sorts on a container.
+// Both music boxes are filled before either is sorted, so neither sort walks nodes that the other one
+// freed and scattered over the heap.
+template <class Playlist>
+void compareSorts(const char* name, const std::string& distribution, const std::vector<std::string>& titles)
+{
+    std::ostream sink(nullptr);     // Discards every MusicBox message.
+    BasicMusicBox<Playlist> quickBox;
+    BasicMusicBox<Playlist> radixBox;
+    fillMusicBox(quickBox, sink, titles);
+    fillMusicBox(radixBox, sink, titles);
+
+    std::ostringstream quickSorted;
+    std::ostringstream radixSorted;
+    double quickTime = timeSort(quickBox, QUICK_SORT, quickSorted);
+    double radixTime = timeSort(radixBox, TITLE_RADIX_SORT, radixSorted);
+
+    std::cout << std::left << std::setw(10) << titles.size() << std::setw(10) << distribution << std::setw(12) << name
+              << std::right << std::fixed << std::setprecision(1) << std::setw(12) << quickTime << std::setw(12) << radixTime
+              << std::setw(9) << std::setprecision(2) << quickTime / radixTime << "x"
+              << (quickSorted.str() == radixSorted.str() ? "" : "  MISMATCH") << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<int> sizes;
+    for (int i = 1; i < argc; i++)
+    {
+        char* end;
+        errno = 0;
+        long songs = std::strtol(argv[i], &end, 10);
+        if (end == argv[i] || *end != '\0' || errno == ERANGE || songs <= 0 || songs > INT_MAX)
+        {
+            std::cerr << "invalid number of songs: " << argv[i] << std::endl;
+            std::cerr << "Usage: TitleSortBench [songs...]" << std::endl;
+            return 1;
+        }
+        sizes.push_back(static_cast<int>(songs));
+    }
+    if (sizes.empty())
+    {
+        sizes.push_back(100000);
+        sizes.push_back(1000000);
+    }
+
+    const char* distributions[] = { "catalog", "mixed", "random" };
+    std::cout << std::left << std::setw(10) << "songs" << std::setw(10) << "titles" << std::setw(12) << "container"
+              << std::right << std::setw(12) << "quick (ms)" << std::setw(12) << "radix (ms)" << std::setw(10) << "speedup" << std::endl;
+    for (std::size_t i = 0; i < sizes.size(); i++)
+    {
+        for (int d = 0; d < 3; d++)
+        {
+            std::vector<std::string> titles = makeTitles(distributions[d], sizes[i]);
+            compareSorts<DoublyLinkedList<Song>>("linked", distributions[d], titles);
+            compareSorts<ContiguousPlaylist>("contiguous", distributions[d], titles);
+        }
+    }
+    return 0;
+}
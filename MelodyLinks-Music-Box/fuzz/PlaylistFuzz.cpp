@@ -0,0 +1,627 @@
+#include "../DoublyLinkedList.h"
+#include "../MusicBox.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/*
+    Author: Ky Lam
+    Date: October 18, 2026
+    Description: A differential fuzz harness for the playlist containers and the music boxes.
+    Every input is read as a sequence of operations, and the same sequence is applied to:
+        MusicBox, ContiguousMusicBox, IntrusiveMusicBox and a MusicBox over
+        DoublyLinkedList<Song, UntrackedSize, UncheckedAccess>, each against a std::vector of (title, duration)
+        with the index of the current song and the seconds played of it;
+        DoublyLinkedList<int> with TrackedSize and CheckedAccess, UntrackedSize and CheckedAccess, and
+        UntrackedSize and UncheckedAccess, against a std::vector<int>.
+    After every operation the playlist is compared with the model in both directions, and so are the current
+    song and the seconds played of it, including where playFor() stops and the songs it reports on the way.
+    The four music boxes must also agree with each other on the current song after every operation.
+    Any difference prints the operation and aborts, so both libFuzzer and the sanitizers report it with the
+    input that caused it.
+    Without libFuzzer, main() runs random inputs from consecutive seeds, or replays the files it is given.
+    Usage: PlaylistFuzz [runs] [bytes per run] [first seed]     (defaults: 1000 2000 0)
+           PlaylistFuzz file...                                  replays saved inputs, for example libFuzzer crashes
+    Build: g++ -std=c++17 -O1 -g -fsanitize=address,undefined -fno-sanitize-recover=all -I.. PlaylistFuzz.cpp -o PlaylistFuzz
+    libFuzzer: clang++ -std=c++17 -O1 -g -fsanitize=fuzzer,address,undefined -DPLAYLIST_FUZZ_LIBFUZZER -I.. PlaylistFuzz.cpp -o PlaylistFuzzer
+*/
+
+// Reads operations and their arguments from the bytes of a fuzz input.
+// Once the bytes run out every read returns 0, so any input is a valid sequence of operations.
+class FuzzInput
+{
+private:
+    const std::uint8_t* data;   // The input bytes.
+    std::size_t size;           // Number of input bytes.
+    std::size_t offset;         // Number of bytes already read.
+
+public:
+    FuzzInput(const std::uint8_t* data, std::size_t size): data(data), size(size), offset(0)
+    {
+    }
+
+    bool done() const
+    {
+        return offset >= size;
+    }
+
+    // A number in [0, limit).
+    int pick(int limit)
+    {
+        return done() ? 0 : data[offset++] % limit;
+    }
+
+    // A short title from a small alphabet, so the same titles come back often.
+    // It includes a space, a NUL byte and a byte above 0x7f, which the title sort must order like std::string.
+    std::string title()
+    {
+        static const char alphabet[] = { 'a', 'b', 'c', 'd', ' ', '\0', '\xff' };
+        std::string text(1, alphabet[pick(4)]);
+        for (int length = pick(4); length > 0; length--)
+        {
+            text += alphabet[pick(7)];
+        }
+        return text;
+    }
+};
+
+// Reports a difference from the model and stops.
+void fuzzCheck(bool condition, const char* target, int operation, const char* what)
+{
+    if (!condition)
+    {
+        std::fprintf(stderr, "\n%s: operation %d: %s\n", target, operation, what);
+        std::abort();
+    }
+}
+
+typedef std::vector<std::pair<std::string, int>> SongModel;     // The songs a music box should hold, in order.
+
+// What a music box should hold and play.
+struct MusicBoxModel
+{
+    SongModel songs;        // The playlist, in order.
+    int current;            // The index of the current song, or -1 if nothing is playing.
+    long long elapsed;      // The seconds of the current song that have already played.
+
+    MusicBoxModel(): current(-1), elapsed(0)
+    {
+    }
+};
+
+// The output of currentSong() for the model.
+std::string expectedCurrentSong(const MusicBoxModel& model)
+{
+    std::ostringstream expected;
+    expected << std::endl;
+    if (model.current < 0)
+    {
+        expected << "Playlist is empty, NOT playing any song now." << std::endl;
+    }
+    else
+    {
+        expected << "Now playing: \"" << model.songs[model.current].first << "\" Duration: " << model.songs[model.current].second
+                 << " seconds." << std::endl;
+    }
+    return expected.str();
+}
+
+// Removes the marked songs from the model. If the current song is one of them, playback moves on to the
+// next remaining song, wrapping around the playlist, or stops if none remains.
+void removeFromModel(MusicBoxModel& model, const std::vector<bool>& removed)
+{
+    int current = model.current;
+    if (current >= 0 && removed[current])
+    {
+        int size = static_cast<int>(model.songs.size());
+        int candidate = (current + 1) % size;
+        while (candidate != current && removed[candidate])
+        {
+            candidate = (candidate + 1) % size;
+        }
+        current = candidate == current ? -1 : candidate;
+        model.elapsed = 0;
+    }
+
+    // The current song keeps its place among the remaining songs.
+    SongModel remaining;
+    model.current = current;
+    for (std::size_t i = 0; i < model.songs.size(); i++)
+    {
+        if (!removed[i])
+        {
+            remaining.push_back(model.songs[i]);
+        }
+        else if (static_cast<int>(i) < current)
+        {
+            model.current--;
+        }
+    }
+    model.songs = remaining;
+}
+
+// Plays the model for a number of seconds, the way playFor() does.
+// Returns: The number of track changes, or -1 if nothing plays.
+long long playModel(MusicBoxModel& model, long long seconds)
+{
+    long long total = 0;
+    std::vector<long long> startTimes;
+    for (std::size_t i = 0; i < model.songs.size(); i++)
+    {
+        startTimes.push_back(total);
+        total += model.songs[i].second;
+    }
+    if (model.current < 0 || seconds <= 0 || total <= 0)
+    {
+        return -1;
+    }
+
+    // Count in 128 bits from the start of the first pass, so even LLONG_MAX seconds cannot overflow.
+    __int128 end = static_cast<__int128>(startTimes[model.current]) + model.elapsed + seconds;
+    long long endTime = static_cast<long long>(end % total);
+    int endIndex = static_cast<int>(std::upper_bound(startTimes.begin(), startTimes.end(), endTime) - startTimes.begin()) - 1;
+    __int128 changes = end / total * static_cast<__int128>(model.songs.size()) + endIndex - model.current;
+
+    model.current = endIndex;
+    model.elapsed = endTime - startTimes[endIndex];
+    return changes > LLONG_MAX ? LLONG_MAX : static_cast<long long>(changes);
+}
+
+// The songs playFor() reports while the model plays for a number of seconds, with the seconds after the start
+// at which each one begins. Call it before playModel().
+std::vector<std::pair<std::pair<std::string, int>, long long>> startedInModel(const MusicBoxModel& model, long long seconds)
+{
+    std::vector<std::pair<std::pair<std::string, int>, long long>> started;
+    long long total = 0;
+    for (std::size_t i = 0; i < model.songs.size(); i++)
+    {
+        total += model.songs[i].second;
+    }
+    if (model.current < 0 || seconds <= 0 || total <= 0)
+    {
+        return started;
+    }
+
+    std::size_t index = model.current;
+    long long offset = model.songs[index].second - model.elapsed;
+    while (offset <= seconds)
+    {
+        index = (index + 1) % model.songs.size();
+        started.push_back(std::make_pair(model.songs[index], offset));
+        offset += model.songs[index].second;
+    }
+    return started;
+}
+
+// Checks a music box against the model: the displayed playlist, the current song and the seconds played of it.
+template <class Playlist>
+void checkMusicBox(BasicMusicBox<Playlist>& musicBox, std::ostringstream& output, const MusicBoxModel& model, const char* target, int operation)
+{
+    output.str("");
+    musicBox.displayPlaylist();
+    std::ostringstream expected;
+    expected << std::endl << "Playlist:" << std::endl;
+    for (std::size_t i = 0; i < model.songs.size(); i++)
+    {
+        expected << model.songs[i].first << " - " << model.songs[i].second << " seconds" << std::endl;
+    }
+    fuzzCheck(output.str() == expected.str(), target, operation, "playlist differs from the model");
+
+    output.str("");
+    musicBox.currentSong();
+    fuzzCheck(output.str() == expectedCurrentSong(model), target, operation, "current song differs from the model");
+    fuzzCheck(musicBox.getCurrentSongElapsed() == model.elapsed, target, operation, "seconds played of the current song differ from the model");
+}
+
+// Reads the playlist of a music box back into a model, for operations whose order the model cannot predict.
+template <class Playlist>
+SongModel readMusicBox(BasicMusicBox<Playlist>& musicBox, std::ostringstream& output)
+{
+    output.str("");
+    musicBox.displayPlaylist();
+    std::istringstream listing(output.str());
+    std::string line;
+    std::getline(listing, line);
+    std::getline(listing, line);
+
+    SongModel songs;
+    while (std::getline(listing, line))
+    {
+        std::size_t separator = line.rfind(" - ");
+        songs.push_back(std::make_pair(line.substr(0, separator), std::atoi(line.c_str() + separator + 3)));
+    }
+    return songs;
+}
+
+// Applies the operations of an input to one kind of music box and its model.
+// Parameters:
+//   - trace: Receives the current song and the seconds played of it after every operation,
+//     which must be the same for every kind of music box.
+template <class Playlist>
+void fuzzMusicBox(const std::uint8_t* data, std::size_t size, const char* target, std::string& trace)
+{
+    FuzzInput input(data, size);
+    std::ostringstream output;
+    BasicMusicBox<Playlist> musicBox;
+    musicBox.setOutput(output);
+    MusicBoxModel model;
+    SongModel& songs = model.songs;
+
+    for (int operation = 0; !input.done(); operation++)
+    {
+        std::string title = input.title();
+        int duration = input.pick(8) - 1;
+        switch (input.pick(12))
+        {
+            case 0:
+            case 1:
+            case 2:
+            {
+                bool added = musicBox.addSong(title, duration);
+                fuzzCheck(added == (duration >= 0), target, operation, "addSong accepted a negative duration or rejected a valid one");
+                if (added)
+                {
+                    songs.push_back(std::make_pair(title, duration));
+                    if (model.current < 0)
+                    {
+                        model.current = 0;
+                        model.elapsed = 0;
+                    }
+                }
+                break;
+            }
+            case 3:
+            {
+                SongModel::iterator match = std::find_if(songs.begin(), songs.end(),
+                    [&title](const std::pair<std::string, int>& song) { return song.first == title; });
+                fuzzCheck(musicBox.removeSong(title, false) == (match != songs.end()), target, operation, "removeSong result");
+                if (match != songs.end())
+                {
+                    std::vector<bool> removed(songs.size(), false);
+                    removed[match - songs.begin()] = true;
+                    removeFromModel(model, removed);
+                }
+                break;
+            }
+            case 4:
+            {
+                // Both sorts order by title only, so songs with equal titles may come out in any order: compare the
+                // titles, then take the durations from the music box. Sorting moves the songs, not the position
+                // of the current one.
+                musicBox.sort(input.pick(2) == 0 ? QUICK_SORT : TITLE_RADIX_SORT);
+                std::stable_sort(songs.begin(), songs.end(),
+                    [](const std::pair<std::string, int>& first, const std::pair<std::string, int>& second) { return first.first < second.first; });
+                SongModel sorted = readMusicBox(musicBox, output);
+                fuzzCheck(sorted.size() == songs.size(), target, operation, "sort changed the number of songs");
+                for (std::size_t i = 0; i < sorted.size(); i++)
+                {
+                    fuzzCheck(sorted[i].first == songs[i].first, target, operation, "sort order");
+                }
+                songs = sorted;
+                if (songs.size() > 1)
+                {
+                    model.elapsed = 0;
+                }
+                break;
+            }
+            case 5:
+            {
+                musicBox.shufflePlaylist(static_cast<unsigned int>(input.pick(256)));
+                SongModel shuffled = readMusicBox(musicBox, output);
+                SongModel before = songs;
+                SongModel after = shuffled;
+                std::sort(before.begin(), before.end());
+                std::sort(after.begin(), after.end());
+                fuzzCheck(before == after, target, operation, "shuffle changed the songs");
+                songs = shuffled;
+                model.elapsed = 0;
+                break;
+            }
+            case 6:
+            {
+                int count = static_cast<int>(songs.size());
+                if (input.pick(2) == 0)
+                {
+                    musicBox.playNext();
+                    model.current = count == 0 ? -1 : (model.current + 1) % count;
+                }
+                else
+                {
+                    musicBox.playPrevious();
+                    model.current = count == 0 ? -1 : (model.current <= 0 ? count - 1 : model.current - 1);
+                }
+                model.elapsed = 0;
+                break;
+            }
+            case 7:
+            {
+                // Mostly short plays, sometimes long enough to pass the whole playlist many times, up to LLONG_MAX.
+                long long seconds = input.pick(40) - 4;
+                if (input.pick(8) == 0)
+                {
+                    seconds = LLONG_MAX - input.pick(256) * (input.pick(2) == 0 ? 1 : 1000000007LL);
+                }
+                output.str("");
+                musicBox.playFor(seconds);
+                std::string current = expectedCurrentSong(model);
+                long long changes = playModel(model, seconds);
+                if (changes >= 0)
+                {
+                    std::ostringstream expected;
+                    expected << std::endl << "Played " << seconds << " seconds with " << changes << " track changes." << std::endl
+                             << "Now playing: \"" << songs[model.current].first << "\" Duration: " << songs[model.current].second
+                             << " seconds, " << model.elapsed << " seconds in." << std::endl;
+                    current = expected.str();
+                }
+                fuzzCheck(output.str() == current, target, operation, "playFor differs from the model");
+                break;
+            }
+            case 8:
+            {
+                long long seconds = input.pick(40);
+                std::vector<std::pair<std::pair<std::string, int>, long long>> expected = startedInModel(model, seconds);
+                std::vector<std::pair<std::pair<std::string, int>, long long>> started;
+                musicBox.playFor(seconds, [&started](std::string_view title, int duration, long long offset)
+                {
+                    started.push_back(std::make_pair(std::make_pair(std::string(title), duration), offset));
+                });
+                fuzzCheck(started == expected, target, operation, "playFor reported other songs than the model");
+                playModel(model, seconds);
+                break;
+            }
+            case 9:
+            {
+                std::vector<bool> removed(songs.size(), false);
+                int count = 0;
+                for (std::size_t i = 0; i < songs.size(); i++)
+                {
+                    removed[i] = songs[i].second < duration;
+                    count += removed[i];
+                }
+                fuzzCheck(musicBox.removeSongsShorterThan(duration) == count, target, operation, "removeSongsShorterThan count");
+                removeFromModel(model, removed);
+                break;
+            }
+            case 10:
+            {
+                std::vector<std::string> titles;
+                titles.push_back(title);
+                titles.push_back(input.title());
+                std::vector<bool> removed(songs.size(), false);
+                int count = 0;
+                for (std::size_t i = 0; i < songs.size(); i++)
+                {
+                    removed[i] = songs[i].first == titles[0] || songs[i].first == titles[1];
+                    count += removed[i];
+                }
+                fuzzCheck(musicBox.removeSongs(titles) == count, target, operation, "removeSongs count");
+                removeFromModel(model, removed);
+                break;
+            }
+            default:
+            {
+                // Copies must be deep: change the copies, then check the original is untouched below.
+                // A copy starts playing its first song from the beginning.
+                MusicBoxModel copied;
+                copied.songs = songs;
+                copied.current = songs.empty() ? -1 : 0;
+                BasicMusicBox<Playlist> copy(musicBox);
+                checkMusicBox(copy, output, copied, target, operation);
+                BasicMusicBox<Playlist> assigned;
+                assigned.setOutput(output);
+                assigned.addSong("assigned", 1);
+                assigned = copy;
+                checkMusicBox(assigned, output, copied, target, operation);
+                copy.addSong(title, 1);
+                assigned.removeSongsShorterThan(1000);
+                assigned.playNext();
+                break;
+            }
+        }
+
+        bool found = musicBox.searchSong(title);
+        bool expected = std::find_if(songs.begin(), songs.end(),
+            [&title](const std::pair<std::string, int>& song) { return song.first == title; }) != songs.end();
+        fuzzCheck(found == expected, target, operation, "searchSong result");
+        checkMusicBox(musicBox, output, model, target, operation);
+
+        output.str("");
+        musicBox.currentSong();
+        trace += output.str();
+        trace += std::to_string(musicBox.getCurrentSongElapsed());
+    }
+}
+
+// Checks a list of ints against the model, walking it forwards and backwards.
+template <class List>
+void checkList(const List& list, const std::vector<int>& model, const char* target, int operation)
+{
+    fuzzCheck(list.getSize() == static_cast<int>(model.size()), target, operation, "getSize differs from the model");
+
+    std::size_t index = 0;
+    Node<int>* previous = nullptr;
+    for (Node<int>* node = list.getHead(); node != nullptr; previous = node, node = node->next, index++)
+    {
+        fuzzCheck(index < model.size() && node->data == model[index], target, operation, "forward walk differs from the model");
+        fuzzCheck(node->previous == previous, target, operation, "previous link is inconsistent");
+    }
+    fuzzCheck(list.getTail() == previous, target, operation, "tail is not the last node");
+    fuzzCheck(index == model.size(), target, operation, "forward walk is too short");
+
+    for (Node<int>* node = list.getTail(); node != nullptr; node = node->previous)
+    {
+        fuzzCheck(index > 0 && node->data == model[--index], target, operation, "backward walk differs from the model");
+    }
+    fuzzCheck(index == 0, target, operation, "backward walk is too short");
+}
+
+// Applies the operations of an input to one configuration of DoublyLinkedList<int> and its model.
+template <class SizePolicy, class AccessPolicy>
+void fuzzList(const std::uint8_t* data, std::size_t size, const char* target)
+{
+    typedef DoublyLinkedList<int, SizePolicy, AccessPolicy> List;
+    FuzzInput input(data, size);
+    List list;
+    std::vector<int> model;
+
+    for (int operation = 0; !input.done(); operation++)
+    {
+        int item = input.pick(8);
+        int position = model.empty() ? 0 : 1 + input.pick(static_cast<int>(model.size()));
+        switch (input.pick(10))
+        {
+            case 0:
+            case 1:
+            case 2:
+                list.push_back(item);
+                model.push_back(item);
+                break;
+            case 3:
+            {
+                std::vector<int>::iterator match = std::find(model.begin(), model.end(), item);
+                fuzzCheck(list.remove(item) == (match != model.end()), target, operation, "remove result");
+                if (match != model.end())
+                {
+                    model.erase(match);
+                }
+                break;
+            }
+            case 4:
+            {
+                std::size_t before = model.size();
+                model.erase(std::remove(model.begin(), model.end(), item), model.end());
+                fuzzCheck(list.erase_all(item) == static_cast<int>(before - model.size()), target, operation, "erase_all count");
+                break;
+            }
+            case 5:
+            {
+                std::size_t before = model.size();
+                model.erase(std::remove_if(model.begin(), model.end(), [item](int value) { return value % 3 == item % 3; }), model.end());
+                fuzzCheck(list.remove_if([item](int value) { return value % 3 == item % 3; }) == static_cast<int>(before - model.size()),
+                    target, operation, "remove_if count");
+                break;
+            }
+            case 6:
+                if (position > 0)
+                {
+                    Node<int>* node = list.getHead();
+                    for (int i = 1; i < position; i++)
+                    {
+                        node = node->next;
+                    }
+                    Node<int>* following = list.erase(node);
+                    model.erase(model.begin() + (position - 1));
+                    fuzzCheck(following == nullptr ? position == static_cast<int>(model.size()) + 1 : following->data == model[position - 1],
+                        target, operation, "erase returned the wrong node");
+                }
+                break;
+            case 7:
+                if (position > 0)
+                {
+                    fuzzCheck(list.at(position) == model[position - 1], target, operation, "at");
+                    fuzzCheck(list.replace(position, item) == model[position - 1], target, operation, "replace returned the wrong item");
+                    model[position - 1] = item;
+                }
+                if constexpr (AccessPolicy::checksAccess)
+                {
+                    // Positions outside the list must throw, with or without a tracked size.
+                    bool thrown = false;
+                    try
+                    {
+                        list.at(input.pick(2) == 0 ? 0 : static_cast<int>(model.size()) + 1);
+                    }
+                    catch (const OutOfRangeExcept&)
+                    {
+                        thrown = true;
+                    }
+                    fuzzCheck(thrown, target, operation, "at() accepted a position outside the list");
+                }
+                break;
+            case 8:
+            {
+                fuzzCheck(list.contains(item) == (std::find(model.begin(), model.end(), item) != model.end()), target, operation, "contains");
+                List copy(list);
+                checkList(copy, model, target, operation);
+                List assigned;
+                assigned.push_back(item);
+                assigned = copy;
+                checkList(assigned, model, target, operation);
+                copy.push_back(item);
+                assigned.clear();
+                break;
+            }
+            default:
+                if (input.pick(4) == 0)
+                {
+                    list.clear();
+                    model.clear();
+                }
+                break;
+        }
+        checkList(list, model, target, operation);
+    }
+}
+
+// Runs one input against every target.
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size)
+{
+    // The music boxes play the same songs after every operation, since even their shuffles are seeded by the input.
+    std::string traces[4];
+    fuzzMusicBox<DoublyLinkedList<Song>>(data, size, "MusicBox", traces[0]);
+    fuzzMusicBox<ContiguousPlaylist>(data, size, "ContiguousMusicBox", traces[1]);
+    fuzzMusicBox<IntrusivePlaylist>(data, size, "IntrusiveMusicBox", traces[2]);
+    fuzzMusicBox<DoublyLinkedList<Song, UntrackedSize, UncheckedAccess>>(data, size, "MusicBox<UntrackedSize, UncheckedAccess>", traces[3]);
+    fuzzCheck(traces[1] == traces[0], "ContiguousMusicBox", -1, "current songs differ from MusicBox");
+    fuzzCheck(traces[2] == traces[0], "IntrusiveMusicBox", -1, "current songs differ from MusicBox");
+    fuzzCheck(traces[3] == traces[0], "MusicBox<UntrackedSize, UncheckedAccess>", -1, "current songs differ from MusicBox");
+    fuzzList<TrackedSize, CheckedAccess>(data, size, "DoublyLinkedList<int>");
+    fuzzList<UntrackedSize, CheckedAccess>(data, size, "DoublyLinkedList<int, UntrackedSize, CheckedAccess>");
+    fuzzList<UntrackedSize, UncheckedAccess>(data, size, "DoublyLinkedList<int, UntrackedSize, UncheckedAccess>");
+    return 0;
+}
+
+#ifndef PLAYLIST_FUZZ_LIBFUZZER
+int main(int argc, char* argv[])
+{
+    if (argc > 1 && std::string(argv[1]).find_first_not_of("0123456789") != std::string::npos)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::ifstream file(argv[i], std::ios::binary);
+            std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+            LLVMFuzzerTestOneInput(bytes.data(), bytes.size());
+            std::printf("%s: passed\n", argv[i]);
+        }
+        return 0;
+    }
+
+    int runs = argc > 1 ? std::atoi(argv[1]) : 1000;
+    int bytesPerRun = argc > 2 ? std::atoi(argv[2]) : 2000;
+    unsigned int firstSeed = argc > 3 ? std::atoi(argv[3]) : 0;
+
+    std::vector<std::uint8_t> bytes(bytesPerRun);
+    for (int run = 0; run < runs; run++)
+    {
+        std::mt19937 random(firstSeed + run);
+        for (int i = 0; i < bytesPerRun; i++)
+        {
+            bytes[i] = static_cast<std::uint8_t>(random());
+        }
+        std::fprintf(stderr, "\rseed %u", firstSeed + run);
+        LLVMFuzzerTestOneInput(bytes.data(), bytes.size());
+    }
+    std::printf("\n%d runs of %d bytes passed\n", runs, bytesPerRun);
+    return 0;
+}
+#endif